@@ -0,0 +1,27 @@
+#ifndef BENCH_POSITIONS_H
+#define BENCH_POSITIONS_H
+
+/*
+ *  bench-positions
+ *
+ *  The positions search-bench searches, the same for every engine so their node counts and times compare: the
+ *  opening, middlegames with and without castling rights, and two endgames.
+ */
+
+namespace bench_positions {
+
+constexpr const char* FENS[] = {
+    "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1",
+    "r3k2r/p1ppqpb1/bn2pnp1/3PN3/1p2P3/2N2Q1p/PPPBBPPP/R3K2R w KQkq - 0 1",
+    "r3k2r/2pb1ppp/2pp1q2/p7/1nP1B3/1P2P3/P2N1PPP/R2QK2R w KQkq a6 0 14",
+    "4rrk1/pp1n3p/3q2pQ/2p1pb2/2PP4/2P3N1/P2B2PP/4RRK1 b - - 7 19",
+    "r1bq1r1k/1pp1n1pp/1p1p4/4p2Q/4Pp2/1BNP4/PPP2PPP/3R1RK1 w - - 2 14",
+    "6k1/6p1/6Pp/ppp5/3pn2P/1P3K2/1PP2P2/3N4 b - - 0 1",
+    "8/8/8/8/5kp1/P7/8/1K1N4 w - - 0 1",
+};
+
+constexpr int COUNT = sizeof(FENS) / sizeof(FENS[0]);
+
+} // namespace bench_positions
+
+#endif // BENCH_POSITIONS_H
@@ -0,0 +1,253 @@
+/*
+ *  eval-kernel
+ *
+ *  See eval-kernel.h. The merged table is built at compile time from the heat maps, so the scalar loop is one
+ *  byte lookup and one table load per square, and the AVX2 path classifies 32 squares per compare. A batch of
+ *  children is kept as structure of arrays, so the AVX2 path loads the table entries of 8 children's n-th change
+ *  as one vector of gather indices.
+ */
+
+#include "eval-kernel.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && !defined(EVAL_KERNEL_SCALAR)
+#define EVAL_KERNEL_HAVE_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace eval_kernel {
+
+namespace {
+
+constexpr char piece_chars[NUM_PIECE_CODES] = { ' ', 'P', 'N', 'B', 'R', 'Q', 'K', 'p', 'n', 'b', 'r', 'q', 'k' };
+
+constexpr PsqtTable build_psqt_table() {
+    PsqtTable t{};
+    const int* tables[6] = { pawn_table, knight_table, bishop_table, rook_table, queen_table, king_table };
+    const int values[6] = { PAWN_VALUE, KNIGHT_VALUE, BISHOP_VALUE, ROOK_VALUE, QUEEN_VALUE, KING_VALUE };
+    for (int p = 0; p < 6; p++) {
+        for (int sq = 0; sq < 64; sq++) {
+            t.rows[WP + p][sq] = static_cast<int16_t>(values[p] + tables[p][sq]);
+            t.rows[BP + p][sq] = static_cast<int16_t>(-(values[p] + tables[p][63 - sq])); // Flips the board for Black
+        }
+    }
+    return t;
+}
+
+constexpr PieceCodeTable build_piece_code_table() {
+    PieceCodeTable t{};
+    for (int code = 1; code < NUM_PIECE_CODES; code++) {
+        t.codes[static_cast<uint8_t>(piece_chars[code])] = static_cast<uint8_t>(code);
+    }
+    return t;
+}
+
+// The bitboards of each child: the parent's, with every changed square moved from its old piece to its new one
+void update_bitboards(const BoardSummary& parent, const ChildBatch& batch, BoardSummary* out) {
+    for (int k = 0; k < batch.count; k++) {
+        for (int code = 0; code < NUM_PIECE_CODES; code++) {
+            out[k].bitboards[code] = parent.bitboards[code];
+        }
+        for (int c = 0; c < MAX_CHANGES; c++) {
+            int before = batch.before[c][k];
+            int after = batch.after[c][k];
+            if (before == after) continue;      // unused
+            uint64_t bit = 1ULL << (before & 63);
+            out[k].bitboards[before >> 6] &= ~bit;
+            out[k].bitboards[after >> 6] |= bit;
+        }
+    }
+}
+
+} // namespace
+
+constexpr PsqtTable psqt = build_psqt_table();
+constexpr PieceCodeTable piece_codes = build_piece_code_table();
+
+void add_child(ChildBatch& batch, const char* squares, const thc::Move& move) {
+    int k = batch.count++;
+    int changes = 0;
+    auto change = [&](int square, int code) {
+        batch.before[changes][k] = piece_code(squares[square]) * 64 + square;
+        batch.after[changes][k] = code * 64 + square;
+        changes++;
+    };
+
+    int piece = piece_code(squares[move.src]);
+    int side = piece >= BP ? BP - WP : 0;      // added to a white piece's code for the mover's
+    int placed = piece;
+    switch (move.special) {
+    case thc::SPECIAL_PROMOTION_QUEEN:  placed = WQ + side; break;
+    case thc::SPECIAL_PROMOTION_ROOK:   placed = WR + side; break;
+    case thc::SPECIAL_PROMOTION_BISHOP: placed = WB + side; break;
+    case thc::SPECIAL_PROMOTION_KNIGHT: placed = WN + side; break;
+    default: break;
+    }
+    change(move.src, EMPTY);
+    change(move.dst, placed);
+
+    switch (move.special) {
+    case thc::SPECIAL_WEN_PASSANT: change(move.dst + 8, EMPTY); break;     // the pawn taken is behind dst
+    case thc::SPECIAL_BEN_PASSANT: change(move.dst - 8, EMPTY); break;
+    case thc::SPECIAL_WK_CASTLING: change(thc::h1, EMPTY); change(thc::f1, WR); break;
+    case thc::SPECIAL_WQ_CASTLING: change(thc::a1, EMPTY); change(thc::d1, WR); break;
+    case thc::SPECIAL_BK_CASTLING: change(thc::h8, EMPTY); change(thc::f8, BR); break;
+    case thc::SPECIAL_BQ_CASTLING: change(thc::a8, EMPTY); change(thc::d8, BR); break;
+    default: break;
+    }
+    for (; changes < MAX_CHANGES; changes++) {
+        batch.before[changes][k] = 0;
+        batch.after[changes][k] = 0;
+    }
+}
+
+void summarise_children_scalar(const BoardSummary& parent, const ChildBatch& batch, BoardSummary* out) {
+    update_bitboards(parent, batch, out);
+    for (int k = 0; k < batch.count; k++) {
+        int score = parent.material_pst;
+        for (int c = 0; c < MAX_CHANGES; c++) {
+            score += (&psqt.rows[0][0])[batch.after[c][k]] - (&psqt.rows[0][0])[batch.before[c][k]];
+        }
+        out[k].material_pst = score;
+    }
+}
+
+void summarise_scalar(const char* squares, BoardSummary& out) {
+    int score = 0;
+    for (int code = 0; code < NUM_PIECE_CODES; code++) {
+        out.bitboards[code] = 0;
+    }
+    for (int i = 0; i < 64; i++) {
+        int code = piece_code(squares[i]);
+        out.bitboards[code] |= 1ULL << i;
+        score += psqt.rows[code][i];
+    }
+    out.material_pst = score;
+}
+
+#ifdef EVAL_KERNEL_HAVE_AVX2
+
+bool avx2_available() {
+    static const bool available = __builtin_cpu_supports("avx2");
+    return available;
+}
+
+__attribute__((target("avx2,popcnt")))
+void summarise_avx2(const char* squares, BoardSummary& out) {
+    const __m256i lo = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(squares));
+    const __m256i hi = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(squares + 32));
+
+    // Classify all 64 squares: one compare per piece per half, OR-ing the piece code into each matching byte
+    __m256i codes_lo = _mm256_setzero_si256();
+    __m256i codes_hi = _mm256_setzero_si256();
+    uint64_t occupied = 0;
+    for (int code = 1; code < NUM_PIECE_CODES; code++) {
+        const __m256i piece = _mm256_set1_epi8(piece_chars[code]);
+        const __m256i eq_lo = _mm256_cmpeq_epi8(lo, piece);
+        const __m256i eq_hi = _mm256_cmpeq_epi8(hi, piece);
+        const __m256i code_v = _mm256_set1_epi8(static_cast<char>(code));
+        codes_lo = _mm256_or_si256(codes_lo, _mm256_and_si256(eq_lo, code_v));
+        codes_hi = _mm256_or_si256(codes_hi, _mm256_and_si256(eq_hi, code_v));
+        uint64_t bb = static_cast<uint32_t>(_mm256_movemask_epi8(eq_lo))
+                    | (static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(eq_hi))) << 32);
+        out.bitboards[code] = bb;
+        occupied |= bb;
+    }
+    out.bitboards[EMPTY] = ~occupied;
+
+    // Score: widen 8 codes at a time to 32 bits, index = code * 64 + square, gather from the int16 table
+    const int* base = reinterpret_cast<const int*>(&psqt.rows[0][0]);
+    __m256i square = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+    const __m256i step = _mm256_set1_epi32(8);
+    __m256i sum = _mm256_setzero_si256();
+    const __m128i quarters[4] = {
+        _mm256_castsi256_si128(codes_lo), _mm256_extracti128_si256(codes_lo, 1),
+        _mm256_castsi256_si128(codes_hi), _mm256_extracti128_si256(codes_hi, 1)
+    };
+    for (int q = 0; q < 4; q++) {
+        for (int half = 0; half < 2; half++) {
+            const __m128i bytes = half ? _mm_srli_si128(quarters[q], 8) : quarters[q];
+            const __m256i code = _mm256_cvtepu8_epi32(bytes);
+            const __m256i index = _mm256_add_epi32(_mm256_slli_epi32(code, 6), square);
+            __m256i value = _mm256_i32gather_epi32(base, index, 2);
+            value = _mm256_srai_epi32(_mm256_slli_epi32(value, 16), 16); // keep the low int16
+            sum = _mm256_add_epi32(sum, value);
+            square = _mm256_add_epi32(square, step);
+        }
+    }
+    __m128i s = _mm_add_epi32(_mm256_castsi256_si128(sum), _mm256_extracti128_si256(sum, 1));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(1, 0, 3, 2)));
+    s = _mm_add_epi32(s, _mm_shuffle_epi32(s, _MM_SHUFFLE(2, 3, 0, 1)));
+    out.material_pst = _mm_cvtsi128_si32(s);
+}
+
+__attribute__((target("avx2")))
+void summarise_children_avx2(const BoardSummary& parent, const ChildBatch& batch, BoardSummary* out) {
+    update_bitboards(parent, batch, out);
+
+    // Lane k is child k: one gather per change for the entries after the move, one for those before
+    const int* base = reinterpret_cast<const int*>(&psqt.rows[0][0]);
+    __m256i sum = _mm256_set1_epi32(parent.material_pst);
+    for (int c = 0; c < MAX_CHANGES; c++) {
+        const __m256i after = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(batch.after[c]));
+        const __m256i before = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(batch.before[c]));
+        __m256i gained = _mm256_i32gather_epi32(base, after, 2);
+        __m256i lost = _mm256_i32gather_epi32(base, before, 2);
+        gained = _mm256_srai_epi32(_mm256_slli_epi32(gained, 16), 16); // keep the low int16
+        lost = _mm256_srai_epi32(_mm256_slli_epi32(lost, 16), 16);
+        sum = _mm256_add_epi32(sum, _mm256_sub_epi32(gained, lost));
+    }
+    alignas(32) int scores[BATCH_SIZE];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(scores), sum);
+    for (int k = 0; k < batch.count; k++) {
+        out[k].material_pst = scores[k];
+    }
+}
+
+#else
+
+bool avx2_available() {
+    return false;
+}
+
+void summarise_avx2(const char* squares, BoardSummary& out) {
+    summarise_scalar(squares, out);
+}
+
+void summarise_children_avx2(const BoardSummary& parent, const ChildBatch& batch, BoardSummary* out) {
+    summarise_children_scalar(parent, batch, out);
+}
+
+#endif
+
+void summarise(const char* squares, BoardSummary& out) {
+    if (avx2_available()) {
+        summarise_avx2(squares, out);
+    } else {
+        summarise_scalar(squares, out);
+    }
+}
+
+void summarise_children(const BoardSummary& parent, const ChildBatch& batch, BoardSummary* out) {
+    if (avx2_available()) {
+        summarise_children_avx2(parent, batch, out);
+    } else {
+        summarise_children_scalar(parent, batch, out);
+    }
+}
+
+void summarise_children(const char* squares, const BoardSummary& parent, const thc::Move* moves, int count,
+                        BoardSummary* out) {
+    for (int first = 0; first < count; first += BATCH_SIZE) {
+        ChildBatch batch;
+        for (int k = first; k < count && batch.count < BATCH_SIZE; k++) {
+            add_child(batch, squares, moves[k]);
+        }
+        summarise_children(parent, batch, out + first);
+    }
+}
+
+const char* backend_name() {
+    return avx2_available() ? "avx2" : "scalar";
+}
+
+} // namespace eval_kernel
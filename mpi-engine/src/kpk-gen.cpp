@@ -0,0 +1,151 @@
+/* kpk-gen.cpp
+ *
+ *  Generates the king + pawn vs king bitbase used by kpk.cpp. Run by the Makefile, which writes its output to
+ *  kpk-bitbase.h.
+ *
+ *  Positions are normalised so the pawn is white and on files a-d (see kpk::index). Every position is first
+ *  classified from the position alone: impossible (kings touching, two pieces on a square, black in check with
+ *  white to move), won (the pawn promotes and cannot be taken), drawn (stalemate, or the pawn can be taken) or
+ *  unknown. Then, in the usual retrograde manner, unknown positions are resolved from their successors until
+ *  nothing changes: white wins if some move wins, black draws if some move draws. Whatever is still unknown at
+ *  the end is a draw.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include "kpk.h"
+
+namespace {
+
+enum Result : unsigned char {
+    INVALID = 0,
+    UNKNOWN = 1,
+    DRAW    = 2,
+    WIN     = 4
+};
+
+// Squares as in thc: a8 = 0, h1 = 63, so the white pawn moves towards 0
+int file_of(int sq) { return sq % 8; }
+int row_of(int sq)  { return sq / 8; }
+
+int distance(int a, int b) {
+    return std::max(std::abs(file_of(a) - file_of(b)), std::abs(row_of(a) - row_of(b)));
+}
+
+bool pawn_attacks(int psq, int sq) {
+    return row_of(sq) == row_of(psq) - 1 && std::abs(file_of(sq) - file_of(psq)) == 1;
+}
+
+// Squares a king on sq can step to
+int king_steps(int sq, int* out) {
+    int n = 0;
+    for (int dr = -1; dr <= 1; dr++) {
+        for (int df = -1; df <= 1; df++) {
+            int r = row_of(sq) + dr, f = file_of(sq) + df;
+            if ((dr || df) && r >= 0 && r < 8 && f >= 0 && f < 8) out[n++] = r * 8 + f;
+        }
+    }
+    return n;
+}
+
+Result initial(bool white_to_move, int wk, int bk, int psq) {
+    int push = psq - 8;
+
+    if (distance(wk, bk) <= 1 || wk == psq || bk == psq || (white_to_move && pawn_attacks(psq, bk))) {
+        return INVALID;
+    }
+
+    // Win if the pawn promotes without getting captured
+    if (white_to_move && row_of(psq) == 1 && wk != push && (distance(bk, push) > 1 || distance(wk, push) == 1)) {
+        return WIN;
+    }
+
+    // Draw if it is stalemate or the black king can take the pawn
+    if (!white_to_move) {
+        int steps[8];
+        int n = king_steps(bk, steps);
+        bool can_move = false;
+        for (int i = 0; i < n; i++) {
+            int sq = steps[i];
+            if (distance(sq, wk) > 1 && !pawn_attacks(psq, sq)) can_move = true;
+        }
+        if (!can_move || (distance(bk, psq) == 1 && distance(wk, psq) > 1)) {
+            return DRAW;
+        }
+    }
+
+    return UNKNOWN;
+}
+
+// Combine the results of all successors (impossible ones contribute nothing)
+Result classify(const std::vector<Result>& db, bool white_to_move, int wk, int bk, int psq) {
+    int r = INVALID;
+    int steps[8];
+
+    if (white_to_move) {
+        int n = king_steps(wk, steps);
+        for (int i = 0; i < n; i++) r |= db[kpk::index(false, steps[i], bk, psq)];
+        if (row_of(psq) > 1) {
+            r |= db[kpk::index(false, wk, bk, psq - 8)];                       // single push
+        }
+        if (row_of(psq) == 6 && psq - 8 != wk && psq - 8 != bk) {
+            r |= db[kpk::index(false, wk, bk, psq - 16)];                      // double push
+        }
+        return (r & WIN) ? WIN : (r & UNKNOWN) ? UNKNOWN : DRAW;
+    } else {
+        int n = king_steps(bk, steps);
+        for (int i = 0; i < n; i++) r |= db[kpk::index(true, wk, steps[i], psq)];
+        return (r & DRAW) ? DRAW : (r & UNKNOWN) ? UNKNOWN : WIN;
+    }
+}
+
+} // namespace
+
+int main() {
+    std::vector<Result> db(kpk::POSITIONS, INVALID);
+
+    auto for_each_position = [](auto f) {
+        for (int stm = 0; stm < 2; stm++)
+            for (int row = 1; row <= 6; row++)
+                for (int file = 0; file < 4; file++)
+                    for (int wk = 0; wk < 64; wk++)
+                        for (int bk = 0; bk < 64; bk++)
+                            f(stm == 0, wk, bk, row * 8 + file);
+    };
+
+    for_each_position([&](bool white_to_move, int wk, int bk, int psq) {
+        db[kpk::index(white_to_move, wk, bk, psq)] = initial(white_to_move, wk, bk, psq);
+    });
+
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for_each_position([&](bool white_to_move, int wk, int bk, int psq) {
+            Result& r = db[kpk::index(white_to_move, wk, bk, psq)];
+            if (r == UNKNOWN) {
+                r = classify(db, white_to_move, wk, bk, psq);
+                changed |= r != UNKNOWN;
+            }
+        });
+    }
+
+    std::vector<unsigned long long> bits(kpk::POSITIONS / 64, 0);
+    int wins = 0;
+    for (int i = 0; i < kpk::POSITIONS; i++) {
+        if (db[i] == WIN) {
+            bits[i / 64] |= 1ULL << (i % 64);
+            wins++;
+        }
+    }
+
+    std::printf("// Generated by kpk-gen, do not edit. %d won positions.\n", wins);
+    std::printf("#ifndef KPK_BITBASE_H\n#define KPK_BITBASE_H\n\n#include <cstdint>\n\n");
+    std::printf("static const uint64_t kpk_bitbase[%d] = {\n", kpk::POSITIONS / 64);
+    for (size_t i = 0; i < bits.size(); i++) {
+        std::printf("%s0x%016llxULL,%s", i % 4 == 0 ? "    " : " ", bits[i], i % 4 == 3 ? "\n" : "");
+    }
+    std::printf("};\n\n#endif // KPK_BITBASE_H\n");
+    return 0;
+}
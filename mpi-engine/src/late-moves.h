@@ -0,0 +1,78 @@
+#ifndef LATE_MOVES_H
+#define LATE_MOVES_H
+
+/*
+ *  late-moves
+ *
+ *  Late move reductions and late move pruning. With good move ordering, a cutoff comes from one of the first few
+ *  moves of a node or not at all, so quiet moves far down the list are searched with fewer plies (and searched
+ *  again at full depth if one of them surprises), and close to the leaves the last of them are not searched.
+ *
+ *  The reduction for a move grows with the log of the plies left and the log of its place in the ordering, as
+ *  in most engines. The table is worked out by the compiler from the constants below, which are the ones to tune.
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include "move-ordering.h"
+
+namespace late_moves {
+
+// Reduction of the n-th move at a node with d plies left: REDUCTION_BASE + ln(d) * ln(n) / REDUCTION_DIVISOR
+constexpr double REDUCTION_BASE = 0.75;
+constexpr double REDUCTION_DIVISOR = 2.25;
+
+constexpr int REDUCTION_MIN_DEPTH = 3;      // plies left at a node for its moves to be reduced
+constexpr int FULL_DEPTH_MOVES = 3;         // moves of a node searched to full depth before any is reduced
+constexpr int PRUNING_MAX_DEPTH = 3;        // plies left up to which late quiet moves are pruned
+
+// Quiet moves with at least this history score have caused enough cutoffs to be reduced a ply less and never pruned
+constexpr int GOOD_HISTORY = move_ordering::MAX_HISTORY / 4;
+
+// Quiet moves searched at a node with depth plies left before the rest are pruned
+constexpr int pruning_limit(int depth) {
+    return 3 + depth * depth;
+}
+
+constexpr int TABLE_SIZE = 64;
+
+// Natural logarithm for constant expressions (std::log is not constexpr): halve x into [1, 2), then the series
+// ln(x) = 2 * (z + z^3 / 3 + z^5 / 5 + ...) with z = (x - 1) / (x + 1)
+constexpr double ln(double x) {
+    int halvings = 0;
+    while (x >= 2.0) {
+        x /= 2.0;
+        halvings++;
+    }
+    double z = (x - 1.0) / (x + 1.0);
+    double term = z;
+    double sum = 0.0;
+    for (int k = 1; k < 40; k += 2) {
+        sum += term / k;
+        term *= z * z;
+    }
+    return halvings * 0.6931471805599453 + 2.0 * sum;
+}
+
+struct ReductionTable {
+    int8_t plies[TABLE_SIZE][TABLE_SIZE];   // [plies left][moves searched before this one]
+
+    constexpr ReductionTable() : plies() {
+        for (int depth = 1; depth < TABLE_SIZE; depth++) {
+            for (int moves = 1; moves < TABLE_SIZE; moves++) {
+                plies[depth][moves] = (int8_t)(REDUCTION_BASE + ln(depth) * ln(moves) / REDUCTION_DIVISOR);
+            }
+        }
+    }
+};
+
+inline constexpr ReductionTable REDUCTIONS{};
+
+// Plies to take off the search of a late move, before any adjustment
+inline int reduction(int depth, int move_number) {
+    return REDUCTIONS.plies[std::min(depth, TABLE_SIZE - 1)][std::min(move_number, TABLE_SIZE - 1)];
+}
+
+} // namespace late_moves
+
+#endif // LATE_MOVES_H
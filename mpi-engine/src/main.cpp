@@ -7,9 +7,14 @@
 
 #include <iostream>
 #include <string>
+#include <chrono>
 #include <vector>
 #include <algorithm>
+#include <cstdlib>
 #include "thc.h"
+#include "search-limits.h"
+#include "telemetry.h"
+#include "perf-counters.h"
 #include "mpi-engine.h"
 
 
@@ -29,6 +34,41 @@ int main(int argc, char* argv[]) {
     MPI_Comm_rank(MPI_COMM_WORLD, &mpi_id);
     MPI_Comm_size(MPI_COMM_WORLD, &mpi_nproc);
 
+    // Every rank reads the same command line, so they all search with the same limits
+    search_limits::SearchLimits limits;
+    std::string telemetry_target;
+    bool count_hardware = false;
+    for (int i = 1; i < argc; i++) {
+        if (std::string(argv[i]) == "--telemetry" && i + 1 < argc) {
+            telemetry_target = argv[++i];
+        } else if (std::string(argv[i]) == "--perf-counters") {
+            count_hardware = true;
+        } else if (!search_limits::parse_flag(argc, argv, i, limits)) {
+            if (mpi_id == 0) std::cout << "Usage: " << argv[0] << " " << search_limits::usage() << " " << telemetry::usage() << " " << perf_counters::usage() << std::endl;
+            MPI_Finalize();
+            return 1;
+        }
+    }
+
+    // Rank 0 writes the telemetry for the whole search
+    int telemetry_ok = mpi_id != 0 || telemetry_target.empty() || telemetry::open(telemetry_target);
+    MPI_Bcast(&telemetry_ok, 1, MPI_INT, 0, MPI_COMM_WORLD);
+    if (!telemetry_ok) {
+        if (mpi_id == 0) std::cout << "Cannot open telemetry output " << telemetry_target << std::endl;
+        MPI_Finalize();
+        return 1;
+    }
+
+    // Every rank counts its own hardware events, or none does
+    std::string counters_error = "not available on every rank";
+    int counters_ok = !count_hardware || perf_counters::open(counters_error);
+    MPI_Allreduce(MPI_IN_PLACE, &counters_ok, 1, MPI_INT, MPI_MIN, MPI_COMM_WORLD);
+    if (!counters_ok) {
+        if (mpi_id == 0) std::cout << "Cannot open hardware counters: " << counters_error << std::endl;
+        MPI_Finalize();
+        return 1;
+    }
+
     // print("HELLO", mpi_id, mpi_nproc);
 
     // Initialize the game
@@ -37,9 +77,19 @@ int main(int argc, char* argv[]) {
 
     MPIEngine engine;
 
+    // Endgame tablebases made by tablebase-generator, from $CHESS_TB_PATH or ./tablebases
+    const char* tablebase_path = std::getenv("CHESS_TB_PATH");
+    int tables = tablebase::init(tablebase_path ? tablebase_path : "tablebases");
+    if (mpi_id == 0 && tables > 0) {
+        std::cout << "Loaded " << tables << " endgame tablebases (up to " << tablebase::max_pieces() << " pieces)" << std::endl;
+    }
+
     bool game_over = false;
     thc::TERMINAL terminal;
 
+    // Both sides' thinking time comes off their clocks, when playing on one
+    auto move_start = std::chrono::steady_clock::now();
+
     while (!game_over) {
         MPI_Barrier(MPI_COMM_WORLD);
         bool white_turn = cr.WhiteToPlay();
@@ -48,7 +98,7 @@ int main(int argc, char* argv[]) {
 
         if ((white_turn and computer_is_white) or (!white_turn and computer_is_black)) {
             // Computer's turn
-            thc::Move best_move = engine.solve(cr, true);
+            thc::Move best_move = engine.solve(cr, true, limits).best_move;
             if (mpi_id == 0) std::cout << "Computer ("<<move_name<<") plays: " << best_move.NaturalOut(&cr) << std::endl;
             cr.PushMove(best_move);
 
@@ -92,6 +142,10 @@ int main(int argc, char* argv[]) {
             cr.PushMove(user_move);
         }
         
+        auto move_end = std::chrono::steady_clock::now();
+        limits.spend(!cr.WhiteToPlay(), std::chrono::duration_cast<std::chrono::milliseconds>(move_end - move_start).count());
+        move_start = move_end;
+
         // Display the board
         if (mpi_id == 0) print_board(cr);
 
@@ -0,0 +1,136 @@
+/*
+ *  material-table
+ *
+ *  See material-table.h. The table is filled in once at start-up by running classify() on every signature it
+ *  covers.
+ */
+
+#include "material-table.h"
+
+namespace material_table {
+
+namespace {
+
+constexpr int PAWN_VALUE   = 100;
+constexpr int KNIGHT_VALUE = 320;
+constexpr int BISHOP_VALUE = 330;
+constexpr int ROOK_VALUE   = 500;
+constexpr int QUEEN_VALUE  = 900;
+
+constexpr int ENDGAME_MATERIAL_THRESHOLD = 2400; // Adjust based on testing
+
+// Scale for a side that is only up to a minor piece ahead and has no pawns left to promote
+constexpr int SCALE_DRAWISH = 16;
+
+// Counts per side the table covers: pawns 0-8, knights/bishops/rooks 0-2, queens 0-1
+constexpr int SIDE_SIGNATURES = 9 * 3 * 3 * 3 * 2;
+
+struct Side {
+    int pawns, knights, bishops, rooks, queens;
+
+    int material() const {
+        return pawns * PAWN_VALUE + knights * KNIGHT_VALUE + bishops * BISHOP_VALUE
+             + rooks * ROOK_VALUE + queens * QUEEN_VALUE;
+    }
+    int pieces() const {
+        return pawns + knights + bishops + rooks + queens;
+    }
+    bool is(int p, int n, int b, int r, int q) const {
+        return pawns == p && knights == n && bishops == b && rooks == r && queens == q;
+    }
+    // A lone minor piece, or two knights, cannot force mate
+    bool cannot_win() const {
+        if (pawns > 0 || rooks > 0 || queens > 0) return false;
+        return knights + bishops <= 1 || (knights == 2 && bishops == 0);
+    }
+};
+
+Side side_of(uint64_t key, bool white) {
+    thc::MATERIAL_FIELD p = white ? thc::MATERIAL_WP : thc::MATERIAL_BP;
+    thc::MATERIAL_FIELD n = white ? thc::MATERIAL_WN : thc::MATERIAL_BN;
+    thc::MATERIAL_FIELD b = white ? thc::MATERIAL_WB : thc::MATERIAL_BB;
+    thc::MATERIAL_FIELD r = white ? thc::MATERIAL_WR : thc::MATERIAL_BR;
+    thc::MATERIAL_FIELD q = white ? thc::MATERIAL_WQ : thc::MATERIAL_BQ;
+    return { thc::material_count(key, p), thc::material_count(key, n), thc::material_count(key, b),
+             thc::material_count(key, r), thc::material_count(key, q) };
+}
+
+// Position of one side's counts in the table, -1 when they are outside it
+int side_index(const Side& s) {
+    if (s.pawns > 8 || s.knights > 2 || s.bishops > 2 || s.rooks > 2 || s.queens > 1) return -1;
+    return (((s.pawns * 3 + s.knights) * 3 + s.bishops) * 3 + s.rooks) * 2 + s.queens;
+}
+
+// Recognise a specialised endgame with the strong side first
+EndgameType endgame_type(const Side& strong, const Side& weak) {
+    if (weak.pieces() == 0) {
+        if (strong.is(1, 0, 0, 0, 0)) return ENDGAME_KPK;
+        if (strong.is(0, 0, 0, 0, 1)) return ENDGAME_KQK;
+        if (strong.is(0, 0, 0, 1, 0)) return ENDGAME_KRK;
+        if (strong.is(0, 1, 1, 0, 0)) return ENDGAME_KBNK;
+    }
+    if (strong.is(0, 0, 0, 1, 0) && weak.is(1, 0, 0, 0, 0)) return ENDGAME_KRKP;
+    return ENDGAME_NONE;
+}
+
+int win_scale(const Side& own, const Side& other) {
+    if (own.cannot_win()) return 0;
+    if (own.pawns == 0 && own.material() - other.material() <= BISHOP_VALUE) return SCALE_DRAWISH;
+    return SCALE_NORMAL;
+}
+
+struct Table {
+    Entry entries[SIDE_SIGNATURES * SIDE_SIGNATURES];
+
+    Table() {
+        for (int wp = 0; wp <= 8; wp++) for (int wn = 0; wn <= 2; wn++) for (int wb = 0; wb <= 2; wb++)
+        for (int wr = 0; wr <= 2; wr++) for (int wq = 0; wq <= 1; wq++) {
+            Side white = { wp, wn, wb, wr, wq };
+            for (int bp = 0; bp <= 8; bp++) for (int bn = 0; bn <= 2; bn++) for (int bb = 0; bb <= 2; bb++)
+            for (int br = 0; br <= 2; br++) for (int bq = 0; bq <= 1; bq++) {
+                Side black = { bp, bn, bb, br, bq };
+                uint64_t key = (uint64_t)wp << thc::MATERIAL_WP | (uint64_t)wn << thc::MATERIAL_WN
+                             | (uint64_t)wb << thc::MATERIAL_WB | (uint64_t)wr << thc::MATERIAL_WR
+                             | (uint64_t)wq << thc::MATERIAL_WQ | (uint64_t)bp << thc::MATERIAL_BP
+                             | (uint64_t)bn << thc::MATERIAL_BN | (uint64_t)bb << thc::MATERIAL_BB
+                             | (uint64_t)br << thc::MATERIAL_BR | (uint64_t)bq << thc::MATERIAL_BQ;
+                entries[side_index(white) * SIDE_SIGNATURES + side_index(black)] = classify(key);
+            }
+        }
+    }
+};
+
+const Table table;
+
+} // namespace
+
+Entry classify(uint64_t key) {
+    Side white = side_of(key, true);
+    Side black = side_of(key, false);
+
+    Entry entry = {};
+    if (white.material() + black.material() <= ENDGAME_MATERIAL_THRESHOLD) entry.flags |= ENDGAME;
+    if (white.cannot_win()) entry.flags |= WHITE_NO_WIN;
+    if (black.cannot_win()) entry.flags |= BLACK_NO_WIN;
+
+    entry.white_scale = win_scale(white, black);
+    entry.black_scale = win_scale(black, white);
+
+    entry.endgame = endgame_type(white, black);
+    entry.strong_white = entry.endgame != ENDGAME_NONE;
+    if (entry.endgame == ENDGAME_NONE) {
+        entry.endgame = endgame_type(black, white);
+    }
+    return entry;
+}
+
+Entry probe(uint64_t key) {
+    int white = side_index(side_of(key, true));
+    int black = side_index(side_of(key, false));
+    if (white < 0 || black < 0) {
+        return classify(key);
+    }
+    return table.entries[white * SIDE_SIGNATURES + black];
+}
+
+} // namespace material_table
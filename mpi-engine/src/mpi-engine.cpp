@@ -13,6 +13,8 @@
 #include <iostream>
 
 #include <utility>
+#include <thread>
+#include <limits>
 #include <cassert>
 
 void print(){std::cout<<std::endl;}
@@ -24,77 +26,12 @@ void print(const T &t, TAIL... tail)
     print(tail...);
 }
 
-// Piece-square tables for evaluation (a.k.a. heat maps)
-const int pawn_table[64] = {
-     0,  0,  0,  0,  0,  0,  0,  0,
-    50, 50, 50, 50, 50, 50, 50, 50,
-    10, 10, 20, 30, 30, 20, 10, 10,
-     5,  5, 10, 25, 25, 10,  5,  5,
-     0,  0,  0, 20, 20,  0,  0,  0,
-     5, -5,-10,  0,  0,-10, -5,  5,
-     5, 10, 10,-20,-20, 10, 10,  5,
-     0,  0,  0,  0,  0,  0,  0,  0
-};
-
-const int knight_table[64] = {
-    -50,-40,-30,-30,-30,-30,-40,-50,
-    -40,-20,  0,  0,  0,  0,-20,-40,
-    -30,  0, 10, 15, 15, 10,  0,-30,
-    -30,  5, 15, 20, 20, 15,  5,-30,
-    -30,  0, 15, 20, 20, 15,  0,-30,
-    -30,  5, 10, 15, 15, 10,  5,-30,
-    -40,-20,  0,  5,  5,  0,-20,-40,
-    -50,-40,-30,-30,-30,-30,-40,-50
-};
-
-const int bishop_table[64] = {
-    -20,-10,-10,-10,-10,-10,-10,-20,
-    -10,  0,  0,  0,  0,  0,  0,-10,
-    -10,  0,  5, 10, 10,  5,  0,-10,
-    -10,  5,  5, 10, 10,  5,  5,-10,
-    -10,  0, 10, 10, 10, 10,  0,-10,
-    -10, 10, 10, 10, 10, 10, 10,-10,
-    -10,  5,  0,  0,  0,  0,  5,-10,
-    -20,-10,-10,-10,-10,-10,-10,-20
-};
-
-const int rook_table[64] = {
-     0,  0,  0,  0,  0,  0,  0,  0,
-     5, 10, 10, 10, 10, 10, 10,  5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-     0,  0,  0,  5,  5,  0,  0,  0
-};
-
-const int queen_table[64] = {
-    -20,-10,-10, -5, -5,-10,-10,-20,
-    -10,  0,  0,  0,  0,  0,  0,-10,
-    -10,  0,  5,  5,  5,  5,  0,-10,
-     -5,  0,  5,  5,  5,  5,  0, -5,
-      0,  0,  5,  5,  5,  5,  0, -5,
-    -10,  5,  5,  5,  5,  5,  0,-10,
-    -10,  0,  5,  0,  0,  0,  0,-10,
-    -20,-10,-10, -5, -5,-10,-10,-20
-};
-
-const int king_table[64] = {
-    -30,-40,-40,-50,-50,-40,-40,-30,
-    -30,-40,-40,-50,-50,-40,-40,-30,
-    -30,-40,-40,-50,-50,-40,-40,-30,
-    -30,-40,-40,-50,-50,-40,-40,-30,
-    -20,-30,-30,-40,-40,-30,-30,-20,
-    -10,-20,-20,-20,-20,-20,-20,-10,
-     20, 20,  0,  0,  0,  0, 20, 20,
-     20, 30, 10,  0,  0, 10, 30, 20
-};
-
-/* Helper function for move scoring. Capturing larger piece is prioritized first.
+/* Helper function for move scoring. Captures and promotions are classed by static exchange evaluation: those
+ * that win material first, then even trades, then quiet moves, and captures that lose material last. Within a
+ * class capturing the larger piece is prioritized first.
  */
 
-float MPIEngine::score_move(const thc::Move& move, thc::ChessRules& cr) {
+float MPIEngine::score_move(const thc::Move& move, thc::ChessRules& cr, int ply) {
     float score = 0.0f;
 
     // Check if the move is a capture
@@ -115,39 +52,25 @@ float MPIEngine::score_move(const thc::Move& move, thc::ChessRules& cr) {
         score += 9.0f; 
     }
 
+    if (!move_ordering::is_quiet(move)) {
+        score += move_ordering::EXCHANGE_BONUS[see::classify(see::evaluate(cr, move))];
+    }
+
     // Positional gain
     int from_index = static_cast<int>(move.src);
     int to_index = static_cast<int>(move.dst);
-    char piece = cr.squares[from_index];
-
-    if (isupper(piece)) { // White pieces
-        switch (piece) {
-            case 'P': score += (pawn_table[to_index] - pawn_table[from_index]) / 100.0f; break;
-            case 'N': score += (knight_table[to_index] - knight_table[from_index]) / 100.0f; break;
-            case 'B': score += (bishop_table[to_index] - bishop_table[from_index]) / 100.0f; break;
-            case 'R': score += (rook_table[to_index] - rook_table[from_index]) / 100.0f; break;
-            case 'Q': score += (queen_table[to_index] - queen_table[from_index]) / 100.0f; break;
-            case 'K': score += (king_table[to_index] - king_table[from_index]) / 100.0f; break;
-        }
-    } else { // Black pieces
-        int flipped_from_index = 63 - from_index;
-        int flipped_to_index = 63 - to_index;
+    score += eval_kernel::psqt_delta(cr.squares[from_index], from_index, to_index) / 100.0f;
 
-        switch (piece) {
-            case 'p': score += (pawn_table[flipped_to_index] - pawn_table[flipped_from_index]) / 100.0f; break;
-            case 'n': score += (knight_table[flipped_to_index] - knight_table[flipped_from_index]) / 100.0f; break;
-            case 'b': score += (bishop_table[flipped_to_index] - bishop_table[flipped_from_index]) / 100.0f; break;
-            case 'r': score += (rook_table[flipped_to_index] - rook_table[flipped_from_index]) / 100.0f; break;
-            case 'q': score += (queen_table[flipped_to_index] - queen_table[flipped_from_index]) / 100.0f; break;
-            case 'k': score += (king_table[flipped_to_index] - king_table[flipped_from_index]) / 100.0f; break;
-        }
+    // Quiet moves that refuted something earlier in the search (killers, countermove, history)
+    if (move_ordering::is_quiet(move)) {
+        score += ordering.quiet_bonus(move, ply, cr.white);
     }
 
     return score;
 }
 
 // Add a mobility bonus for the pieces (not sure if this helps).
-int MPIEngine::evaluate_mobility(thc::ChessRules& cr, bool is_white, const std::vector<int>& piece_indices) {
+int MPIEngine::evaluate_mobility(thc::ChessRules& cr, bool is_white) {
     int mobility_score = 0;
     thc::ChessRules cr_copy = cr;
     std::vector<thc::Move> moves;
@@ -170,13 +93,13 @@ int MPIEngine::evaluate_mobility(thc::ChessRules& cr, bool is_white, const std::
     return mobility_score;
 }
 
-int MPIEngine::evaluate_pawn_structure(const std::vector<int>& pawn_files, bool is_white) {
+int MPIEngine::evaluate_pawn_structure(uint64_t pawns, bool is_white) {
     int score = 0;
 
     // Count pawns on each file
     int file_counts[8] = {0};
-    for (int file : pawn_files) {
-        file_counts[file]++;
+    for (int i = 0; i < 8; ++i) {
+        file_counts[i] = __builtin_popcountll(pawns & (0x0101010101010101ULL << i));
     }
 
     // Evaluate pawn structure
@@ -289,180 +212,444 @@ int MPIEngine::evaluate_king_activity(int own_king_index, int opponent_king_inde
 }
 
 
-const int ENDGAME_MATERIAL_THRESHOLD = 2400; // Adjust based on testing
+/* A tablebase result is scored like the mate it leads to, counting the plies already searched, so the engine
+ * prefers quicker wins and slower losses just as it does for mates found by search. */
+bool MPIEngine::probe_tablebase(const thc::ChessRules& cr, int depth, Score& score) {
+    tablebase::Wdl wdl;
+    int plies;
+    if (!tablebase::probe(cr, wdl, plies)) {
+        return false;
+    }
+    if (wdl == tablebase::DRAW) {
+        score = 0.0f;
+        return true;
+    }
 
-bool MPIEngine::is_endgame(int white_material, int black_material) {
-    int total_material = white_material + black_material;
-    return total_material <= ENDGAME_MATERIAL_THRESHOLD; // Define a threshold, e.g., 2400 (two rooks)
+    Score mate = INF_SCORE - (depth + (plies < 0 ? TABLEBASE_MATE_PLIES : plies));
+    score = (wdl == tablebase::WIN) == cr.white ? mate : -mate;
+    return true;
 }
 
-MPIEngine::Score MPIEngine::static_eval(thc::ChessRules& cr) {
-    Score total_score = 0.0f;
+/* Lazy evaluation. The terms of static_eval are added cheapest first, and after each stage we check whether the
+ * terms still to come could bring the score back inside (alpha, beta). If not, the leaf is already a fail-low or
+ * fail-high for its parent, so we return the most optimistic (resp. pessimistic) score it could still reach and
+ * skip the rest, mobility in particular since it generates the legal moves.
+ *
+ * The bounds below are how far each term can move the score (white minus black, both sides together):
+ *   pawn structure  each side scores between -145 (7 doubled, 4 islands, 4 isolated files) and +5 (no pawns)
+ *   king safety     each side scores between -20 and +30, only outside the endgame
+ *   king activity   each side scores between -43 and +43, only in the endgame
+ *   mobility        see mobility_bound(), from the piece counts
+ * The final material scaling only ever moves a score towards 0, so it is applied to the bounds as well.
+ */
+const int PAWN_STRUCTURE_BOUND = 150;
+const int KING_SAFETY_BOUND = 50;
+const int KING_ACTIVITY_BOUND = 86;
+
+// Most mobility one side can score: every piece with its maximum number of moves
+int MPIEngine::mobility_bound(const eval_kernel::BoardSummary& board, bool is_white) {
+    int base = is_white ? eval_kernel::WP : eval_kernel::BP;
+    return eval_kernel::piece_count(board, base + 1) * 8 * 4      // knights
+         + eval_kernel::piece_count(board, base + 2) * 13 * 4     // bishops
+         + eval_kernel::piece_count(board, base + 3) * 14 * 2     // rooks
+         + eval_kernel::piece_count(board, base + 4) * 27 * 1;    // queens
+}
 
-    // Material counts
-    int white_material = 0;
-    int black_material = 0;
+MPIEngine::Score MPIEngine::static_eval(thc::ChessRules& cr, Score alpha_score, Score beta_score) {
+    // Evaluate material and positional bonuses for the whole board at once (see eval-kernel.h)
+    eval_kernel::BoardSummary board;
+    eval_kernel::summarise(cr.squares, board);
+    return static_eval(cr, board, alpha_score, beta_score);
+}
 
-    // Piece counts for bishop pair evaluation
-    int white_bishops = 0;
-    int black_bishops = 0;
+MPIEngine::Score MPIEngine::static_eval(thc::ChessRules& cr, const eval_kernel::BoardSummary& board,
+                                              Score alpha_score, Score beta_score) {
+    PROFILE_ZONE(profile::STATIC_EVAL);
+    Score total_score = board.material_pst;
 
-    // King positions
-    int white_king_index = -1;
-    int black_king_index = -1;
-
-    // Variables for pawn structure
-    std::vector<int> white_pawn_files;
-    std::vector<int> black_pawn_files;
-
-    // Piece positions for mobility evaluation
-    std::vector<int> white_piece_indices;
-    std::vector<int> black_piece_indices;
-
-    // Evaluate material and positional bonuses
-    for (int i = 0; i < 64; i++) {
-        char piece = cr.squares[i];
-        if (piece == ' ')
-            continue;
-
-        int index = i;
-        int flipped_index = 63 - i; // Flips the board for Black
-        int piece_value = 0;
-        float positional_bonus = 0.0f;
-
-        bool is_white = isupper(piece);
-        char lower_piece = tolower(piece);
-
-        switch (lower_piece) {
-            case 'p':
-                piece_value = 100;
-                positional_bonus = pawn_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_pawn_files.push_back(index % 8);
-                } else {
-                    black_material += piece_value;
-                    black_pawn_files.push_back(index % 8);
-                }
-                break;
-            case 'n':
-                piece_value = 320;
-                positional_bonus = knight_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_piece_indices.push_back(index);
-                } else {
-                    black_material += piece_value;
-                    black_piece_indices.push_back(index);
-                }
-                break;
-            case 'b':
-                piece_value = 330;
-                positional_bonus = bishop_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_bishops++;
-                    white_piece_indices.push_back(index);
-                } else {
-                    black_material += piece_value;
-                    black_bishops++;
-                    black_piece_indices.push_back(index);
-                }
-                break;
-            case 'r':
-                piece_value = 500;
-                positional_bonus = rook_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_piece_indices.push_back(index);
-                } else {
-                    black_material += piece_value;
-                    black_piece_indices.push_back(index);
-                }
-                break;
-            case 'q':
-                piece_value = 900;
-                positional_bonus = queen_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_piece_indices.push_back(index);
-                } else {
-                    black_material += piece_value;
-                    black_piece_indices.push_back(index);
-                }
-                break;
-            case 'k':
-                piece_value = 20000; // High value for the King
-                positional_bonus = king_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_king_index = index;
-                } else {
-                    black_king_index = index;
-                }
-                break;
-            default:
-                break;
-        }
+    // Game phase, scaling and endgame type for this material (see material-table.h)
+    material_table::Entry material = material_table::probe(cr.material_key);
+    bool endgame = material.flags & material_table::ENDGAME;
 
-        Score square_score = piece_value + positional_bonus;
-        if (is_white) {
-            total_score += square_score;
-        } else {
-            total_score -= square_score;
-        }
+    // Specialised endgames (KPK, KQK, KRK, KBNK, KRKP) have an evaluator of their own (see endgame.h)
+    if (material.endgame != material_table::ENDGAME_NONE) {
+        return endgame::evaluate(material.endgame, board, material.strong_white, cr.WhiteToPlay());
     }
 
-    // Bishop pair bonus
-    if (white_bishops >= 2) total_score += 50;
-    if (black_bishops >= 2) total_score -= 50;
+    // King positions
+    int white_king_index = eval_kernel::king_square(board, true);
+    int black_king_index = eval_kernel::king_square(board, false);
 
-    // Mobility evaluation
-    total_score += evaluate_mobility(cr, true, white_piece_indices);
-    total_score -= evaluate_mobility(cr, false, black_piece_indices);
+    // Bishop pair bonus
+    if (eval_kernel::piece_count(board, eval_kernel::WB) >= 2) total_score += 50;
+    if (eval_kernel::piece_count(board, eval_kernel::BB) >= 2) total_score -= 50;
+
+    // Stage 1: material only, give up if the positional terms cannot reach the window
+    int white_mobility_bound = mobility_bound(board, true);
+    int black_mobility_bound = mobility_bound(board, false);
+    int positional_bound = PAWN_STRUCTURE_BOUND + (endgame ? KING_ACTIVITY_BOUND : KING_SAFETY_BOUND);
+    Score upper = material_table::scale(material, total_score + positional_bound + white_mobility_bound);
+    Score lower = material_table::scale(material, total_score - positional_bound - black_mobility_bound);
+    if (upper <= alpha_score) return upper;
+    if (lower >= beta_score) return lower;
 
     // Pawn structure evaluation
-    total_score += evaluate_pawn_structure(white_pawn_files, true);
-    total_score -= evaluate_pawn_structure(black_pawn_files, false);
+    total_score += evaluate_pawn_structure(board.bitboards[eval_kernel::WP], true);
+    total_score -= evaluate_pawn_structure(board.bitboards[eval_kernel::BP], false);
 
     // King safety evaluation
-
-    bool endgame = is_endgame(white_material, black_material);
-
     total_score += evaluate_king_safety(cr, white_king_index, true, endgame);
     total_score -= evaluate_king_safety(cr, black_king_index, false, endgame);
 
-    // After calculating total material
-    
     // Evaluate king activity in endgame
     if (endgame) {
         total_score += evaluate_king_activity(white_king_index, black_king_index, true);
         total_score -= evaluate_king_activity(black_king_index, white_king_index, false);
     }
 
+    // Stage 2: everything but mobility, which is the expensive term
+    upper = material_table::scale(material, total_score + white_mobility_bound);
+    lower = material_table::scale(material, total_score - black_mobility_bound);
+    if (upper <= alpha_score) return upper;
+    if (lower >= beta_score) return lower;
+
+    // Mobility evaluation
+    total_score += evaluate_mobility(cr, true);
+    total_score -= evaluate_mobility(cr, false);
+
+    // Pull the score towards a draw when the side ahead lacks the material to win
+    return material_table::scale(material, total_score);
+}
 
-    return total_score;
+/* Rank 0 owns the clock and the node count. The first time it finds its hard limit passed or the node limit
+ * reached, it broadcasts the stop with MPI_Ibcast on stop_comm, and the other ranks, which posted the receive when
+ * the iteration began, test for it every POLL_INTERVAL nodes without blocking. A rank the stop has reached returns
+ * at once from every node it searches alone; the nodes it shares with other ranks still run their collectives, so
+ * all of them unwind together into the reduction at the root.
+ */
+bool MPIEngine::stop_requested(bool shared) {
+    if (time_limit_reached) {
+        return true;
+    }
+    if (world_rank == 0) {
+        // Rank 0 only counts its own nodes of the iteration under way, and takes every rank to have searched as
+        // many, as the ranks share the moves out evenly. The count costs a comparison, so unlike the clock it is
+        // checked at every node.
+        bool out_of_nodes = node_limit > 0
+                            && nodes_searched + stats[search_stats::EVALUATED] * world_size >= node_limit;
+        if (out_of_nodes || timer.poll(shared ? 1 : time_manager::POLL_INTERVAL)) {
+            stop_flag = 1;
+            stop_posted = true;
+            time_limit_reached = true;
+            MPI_Ibcast(&stop_flag, 1, MPI_INT, 0, stop_comm, &stop_request);
+        }
+    } else if (shared || ++stop_polls % time_manager::POLL_INTERVAL == 0) {
+        int arrived = 0;
+        MPI_Test(&stop_request, &arrived, MPI_STATUS_IGNORE);
+        if (arrived && stop_flag) {
+            time_limit_reached = true;
+        }
+    }
+    return time_limit_reached;
 }
 
-int debug_node_count = 0;
+/* A rank that is done with its share of a node waits here for the others. Rank 0 owns the clock, so it must not
+ * block: it waits on a non-blocking reduction and keeps checking the clock, otherwise a rank 0 that finished early
+ * could not stop the ranks still searching.
+ */
+std::pair<MPIEngine::Score, thc::Move>
+MPIEngine::reduce_best(const std::pair<Score, thc::Move>& ans_pair, MPI_Op op, MPI_Comm comm) {
+    std::pair<Score, thc::Move> best_ans;
+    MPI_Request request;
+    MPI_Iallreduce(&ans_pair, &best_ans, 1, MPI_FLOAT_INT, op, comm, &request);
+    if (world_rank != 0) {
+        MPI_Wait(&request, MPI_STATUS_IGNORE);
+        return best_ans;
+    }
+
+    int done = 0;
+    MPI_Test(&request, &done, MPI_STATUS_IGNORE);
+    while (!done) {
+        stop_requested(true);
+        std::this_thread::yield();
+        MPI_Test(&request, &done, MPI_STATUS_IGNORE);
+    }
+    return best_ans;
+}
 
-thc::Move MPIEngine::solve(thc::ChessRules& cr, bool is_white_player) {
+/* Quiescence search. A leaf of the main search can be in the middle of an exchange, where the static evaluation
+ * means little, so captures and promotions are played on until the position is quiet. The side to move can always
+ * decline them and stand pat on the static evaluation. Moves that lose material by static exchange evaluation are
+ * not tried at all: they would almost never do better than standing pat.
+ */
+MPIEngine::Score MPIEngine::quiescence(
+    thc::ChessRules& cr,
+    int ply,
+    Score alpha_score,
+    Score beta_score,
+    const eval_kernel::BoardSummary* board
+) {
+    stats.add(search_stats::QNODES);
+    stats.add(search_stats::EVALUATED);
+    stats.reach(ply);
+
+    Score stand_pat = board ? static_eval(cr, *board, alpha_score, beta_score)
+                            : static_eval(cr, alpha_score, beta_score);
+    if (cr.white) {
+        if (stand_pat >= beta_score) return stand_pat;
+        alpha_score = std::max(alpha_score, stand_pat);
+    } else {
+        if (stand_pat <= alpha_score) return stand_pat;
+        beta_score = std::min(beta_score, stand_pat);
+    }
+
+    std::vector<thc::Move> legal_moves;
+    cr.GenLegalMoveList(legal_moves);
+
+    // Captures and promotions that do not lose material, best exchange first
+    std::vector<std::pair<int, thc::Move>> exchanges;
+    for (const auto& move : legal_moves) {
+        if (move_ordering::is_quiet(move)) continue;
+        int exchange = see::evaluate(cr, move);
+        if (exchange >= 0) {
+            exchanges.emplace_back(exchange, move);
+        }
+    }
+    std::sort(exchanges.begin(), exchanges.end(), [](const std::pair<int, thc::Move>& a, const std::pair<int, thc::Move>& b) {
+        return a.first > b.first;
+    });
+
+    Score best_score = stand_pat;
+    for (auto& [exchange, move] : exchanges) {
+        cr.PushMove(move);
+        Score current_score = quiescence(cr, ply + 1, alpha_score, beta_score);
+        cr.PopMove(move);
+
+        if (cr.white) {
+            best_score = std::max(best_score, current_score);
+            alpha_score = std::max(alpha_score, best_score);
+        } else {
+            best_score = std::min(best_score, current_score);
+            beta_score = std::min(beta_score, best_score);
+        }
+        if (beta_score <= alpha_score) {
+            break;
+        }
+    }
+
+    return best_score;
+}
+
+/* Null move pruning. If the side to move could pass and still get a cutoff from a search a few plies shallower,
+ * a real move will almost always do at least as well, so the node is cut off without searching any. That fails in
+ * zugzwang, which is why the side to move must have a piece besides pawns, and two null moves in a row are not
+ * allowed. Close to the root, where a wrong cutoff costs the most, the cutoff is confirmed by a search of the real
+ * moves to the same reduced depth. Every rank of comm takes the same decisions, so the searches stay collective.
+ */
+bool MPIEngine::null_move_cutoff(thc::ChessRules& cr, bool is_white_player, int depth, int max_depth,
+                                 Score alpha_score, Score beta_score, NodeEval& node_eval, MPI_Comm comm) {
+    // is_white_player is the side minimising the score
+    bool maximising = !is_white_player;
+    int remaining = max_depth - depth;
+    Score bound = maximising ? beta_score : alpha_score;
+    if (remaining < NULL_MOVE_MIN_DEPTH || !material_table::has_pieces(cr.material_key, cr.white)
+            || std::abs(bound) >= INF_SCORE / 2) {
+        return false;
+    }
+
+    // Only worth trying when the side to move is already doing well enough
+    Score eval = evaluate_once(cr, node_eval, remaining, alpha_score, beta_score);
+    if (maximising ? eval < beta_score : eval > alpha_score) {
+        return false;
+    }
+
+    int reduction = remaining >= NULL_MOVE_DEEP_DEPTH ? 3 : 2;
+    Score null_alpha = maximising ? bound - NULL_WINDOW : bound;
+    Score null_beta = maximising ? bound : bound + NULL_WINDOW;
+    auto cutoff = [&](Score score) {
+        return maximising ? score >= bound : score <= bound;
+    };
+
+    cr.PushNullMove();
+    if (depth < move_ordering::MAX_PLY) {
+        ordering.played[depth].Invalid();
+    }
+    Score null_score = solve_mpi_engine(cr, !is_white_player, depth + 1, max_depth - reduction,
+                                        null_alpha, null_beta, comm, false).first;
+    cr.PopNullMove();
+
+    if (!cutoff(null_score)) {
+        return false;
+    }
+    if (remaining < NULL_MOVE_VERIFY_DEPTH) {
+        return true;
+    }
+
+    Score verified_score = solve_mpi_engine(cr, is_white_player, depth, max_depth - reduction,
+                                            null_alpha, null_beta, comm, false).first;
+    return cutoff(verified_score);
+}
+
+/* Pruning near the horizon, all three decided by the static eval of the node, which is cheap next to a search of
+ * its moves. The margins grow with the plies left, since a deeper search has more room to change the score.
+ *
+ *   reverse futility  the eval beats the bound by a margin: assume a real move keeps it there and fail high
+ *   razoring          the eval is so far short of the bound that only captures could help: try quiescence
+ *                     instead, and believe it if it fails low too
+ *   futility          the eval plus a margin still does not reach the bound: quiet moves that give no check are
+ *                     skipped in the move loop, counted as worth eval + margin
+ *
+ * None of it is tried in check, at the root, or when a bound is a mate score. No communication is needed: every
+ * rank of a communicator reaches the same decision from the same board.
+ */
+bool MPIEngine::horizon_cutoff(thc::ChessRules& cr, bool is_white_player, int depth, int max_depth,
+                               Score alpha_score, Score beta_score, NodeEval& node_eval, Score& score, bool& futile) {
+    futile = false;
+    int remaining = max_depth - depth;
+    if (remaining > HORIZON_MAX_DEPTH
+            || std::abs(alpha_score) >= INF_SCORE / 2 || std::abs(beta_score) >= INF_SCORE / 2) {
+        return false;
+    }
+
+    // From the side to move's point of view, so the maximiser and minimiser share the tests (here is_white_player
+    // is the side minimising the score)
+    Score sign = is_white_player ? -1.0f : 1.0f;
+    Score eval = sign * evaluate_once(cr, node_eval, remaining, alpha_score, beta_score);
+    Score alpha = is_white_player ? -beta_score : alpha_score;
+    Score beta = is_white_player ? -alpha_score : beta_score;
+
+    if (remaining <= REVERSE_FUTILITY_MAX_DEPTH && eval - REVERSE_FUTILITY_MARGIN * remaining >= beta) {
+        score = sign * (eval - REVERSE_FUTILITY_MARGIN * remaining);
+        return true;
+    }
+
+    if (remaining <= RAZOR_MAX_DEPTH && eval + RAZOR_MARGIN[remaining] <= alpha) {
+        Score quiet_score = quiescence(cr, depth, alpha_score, beta_score);
+        if (sign * quiet_score <= alpha) {
+            score = quiet_score;
+            return true;
+        }
+    }
+
+    if (remaining <= FUTILITY_MAX_DEPTH && eval + FUTILITY_MARGIN[remaining] <= alpha) {
+        futile = true;
+        score = sign * (eval + FUTILITY_MARGIN[remaining]);
+    }
+    return false;
+}
+
+/* The pruning tests of a node all decide on its static eval, so the first of them to need it evaluates the node
+ * and the rest reuse the value. The window is widened by the widest margin a test compares the eval against with
+ * this many plies left (null move pruning compares it with the bound itself), so a lazy exit never changes one of
+ * their decisions.
+ */
+MPIEngine::Score MPIEngine::evaluate_once(thc::ChessRules& cr, NodeEval& node_eval, int remaining,
+                                          Score alpha_score, Score beta_score) {
+    if (!node_eval.known) {
+        Score margin = 0.0f;
+        if (remaining <= REVERSE_FUTILITY_MAX_DEPTH) {
+            margin = std::max(margin, REVERSE_FUTILITY_MARGIN * remaining);
+        }
+        if (remaining <= FUTILITY_MAX_DEPTH) {
+            margin = std::max(margin, FUTILITY_MARGIN[remaining]);
+        }
+        if (remaining <= RAZOR_MAX_DEPTH) {
+            margin = std::max(margin, RAZOR_MARGIN[remaining]);
+        }
+        node_eval.value = static_eval(cr, alpha_score - margin, beta_score + margin);
+        node_eval.known = true;
+    }
+    return node_eval.value;
+}
+
+/* Each rank has results for the root moves it searched itself, but the ranks must agree on the order of the list,
+ * since they deal its moves out among themselves by index. So the results are pooled first: a root move was
+ * searched either by a single rank or by a group that all know its score, which makes the highest score reported
+ * its score, and its subtree is the sum of what each rank searched of it.
+ */
+void MPIEngine::complete_root_list(thc::ChessRules& cr) {
+    const float unsearched = std::numeric_limits<float>::lowest();
+    const auto& moves = root_list.moves();
+    int count = moves.size();
+    std::vector<float> scores(count);
+    std::vector<uint64_t> nodes(count);
+    for (int i = 0; i < count; i++) {
+        scores[i] = moves[i].pending_searched ? moves[i].pending_score : unsearched;
+        nodes[i] = moves[i].pending_searched ? moves[i].pending_nodes : 0;
+    }
+    MPI_Allreduce(MPI_IN_PLACE, scores.data(), count, MPI_FLOAT, MPI_MAX, MPI_COMM_WORLD);
+    MPI_Allreduce(MPI_IN_PLACE, nodes.data(), count, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    for (int i = 0; i < count; i++) {
+        if (scores[i] != unsearched) {
+            root_list.record(moves[i].move, scores[i], nodes[i]);
+        }
+    }
+    root_list.complete(cr.white);
+}
+
+search_limits::SearchResult MPIEngine::solve(thc::ChessRules& cr, bool is_white_player,
+                                             const search_limits::SearchLimits& limits) {
     this->time_limit_reached = false;
 
-    int pid;
+    int pid, nproc;
 
     MPI_Comm_rank(MPI_COMM_WORLD, &pid);
+    MPI_Comm_size(MPI_COMM_WORLD, &nproc);
     this->start_time = std::chrono::steady_clock::now();
-
-    thc::Move best_move_so_far;
+    this->timer.start(limits, cr.white, DEFAULT_TIME_LIMIT_SECONDS);
+    this->node_limit = limits.nodes;
+    this->world_rank = pid;
+    this->world_size = nproc;
+    if (stop_comm == MPI_COMM_NULL) {
+        MPI_Comm_dup(MPI_COMM_WORLD, &stop_comm);
+    }
+    this->nodes_searched = 0;
+    int depth_limit = limits.max_depth(DEFAULT_DEPTH);
+    profile::begin();
+    perf_counters::attach(0);
+    std::vector<perf_counters::Values> search_counters = perf_counters::read();
+    uint64_t rank_nodes_searched = 0;
+
+    search_limits::SearchResult result;
     bool move_found = false;
+    bool mate_found = false;
 
-    for (int current_depth = 1; current_depth <= MAX_DEPTH; ++current_depth) {
-        debug_node_count = 0;
-        if (time_limit_reached) {
-            break; 
+    ordering.clear();
+
+    // Keep the root move order of the last search if this is the same position, else start from score_move
+    if (!root_list.begin(cr)) {
+        std::vector<thc::Move> legal_moves;
+        cr.GenLegalMoveList(legal_moves);
+        std::vector<std::pair<float, thc::Move>> scored_moves;
+        for (const auto& move : legal_moves) {
+            scored_moves.emplace_back(score_move(move, cr, 0), move);
+        }
+        std::stable_sort(scored_moves.begin(), scored_moves.end(), [](const std::pair<float, thc::Move>& a, const std::pair<float, thc::Move>& b) {
+            return a.first > b.first;
+        });
+        root_list.reset(scored_moves);
+    }
+
+    for (int current_depth = 1; current_depth <= depth_limit && !mate_found; ++current_depth) {
+        stats.clear();
+        // The soft time limit and the node limit are checked between iterations, the hard limit and the node limit
+        // inside them (see stop_requested). Rank 0 decides, so that every rank starts the same iterations.
+        int out_of_limits = pid == 0 && (!timer.time_for_iteration() || (node_limit > 0 && nodes_searched >= node_limit));
+        MPI_Bcast(&out_of_limits, 1, MPI_INT, 0, MPI_COMM_WORLD);
+        if (out_of_limits) {
+            break;
+        }
+
+        // Rank 0 broadcasts the stop flag of the iteration when its hard limit passes, or clear once the search is
+        // over. The other ranks post the receive now and poll it as they search.
+        stop_flag = 0;
+        stop_posted = false;
+        if (pid != 0) {
+            MPI_Ibcast(&stop_flag, 1, MPI_INT, 0, stop_comm, &stop_request);
         }
 
         // thc::Move current_best_move;
+        std::vector<perf_counters::Values> iteration_counters = perf_counters::read();
         auto [current_score, current_best_move] = solve_mpi_engine(
             cr,
             is_white_player,
@@ -473,13 +660,51 @@ thc::Move MPIEngine::solve(thc::ChessRules& cr, bool is_white_player) {
             MPI_COMM_WORLD
         );
 
+        // Every rank learns whether the iteration was stopped, and keeps the last complete one if it was
+        if (pid == 0 && !stop_posted) {
+            MPI_Ibcast(&stop_flag, 1, MPI_INT, 0, stop_comm, &stop_request);
+        }
+        MPI_Wait(&stop_request, MPI_STATUS_IGNORE);
+        time_limit_reached = stop_flag != 0;
+
         if (time_limit_reached) {
             break; 
         }
 
-        best_move_so_far = current_best_move;
+        perf_counters::Values hardware = perf_counters::total(perf_counters::difference(perf_counters::read(), iteration_counters));
+        // Every rank counts what it searched, and orders its own share of the moves: add their counts up
+        search_stats::Values totals;
+        MPI_Allreduce(stats.values().data(), totals.data(), search_stats::COUNTER_COUNT, MPI_UINT64_T, MPI_SUM,
+                      MPI_COMM_WORLD);
+        search_stats::Counters iteration(totals);
+        nodes_searched += iteration[search_stats::EVALUATED];
+        rank_nodes_searched += stats[search_stats::EVALUATED];
+
+        // Rank 0 also learns the deepest ply any rank reached, and how the nodes were shared out
+        int seldepth = stats.seldepth();
+        MPI_Reduce(pid == 0 ? MPI_IN_PLACE : &seldepth, &seldepth, 1, MPI_INT, MPI_MAX, 0, MPI_COMM_WORLD);
+        iteration.reach(seldepth);
+        uint64_t rank_nodes = stats[search_stats::EVALUATED];
+        std::vector<uint64_t> nodes_per_rank(pid == 0 ? nproc : 0);
+        MPI_Gather(&rank_nodes, 1, MPI_UINT64_T, nodes_per_rank.data(), 1, MPI_UINT64_T, 0, MPI_COMM_WORLD);
+        if (perf_counters::enabled()) {
+            MPI_Reduce(pid == 0 ? MPI_IN_PLACE : hardware.data(), hardware.data(), perf_counters::EVENT_COUNT,
+                       MPI_UINT64_T, MPI_SUM, 0, MPI_COMM_WORLD);
+        }
+
+        result.best_move = current_best_move;
+        result.score = current_score;
+        result.depth = current_depth;
+        timer.iteration_complete(current_best_move);
         move_found = true;
 
+        // A mate within the depth searched is as short as the search can find, deeper iterations would only
+        // prove it again. It is proven already: no move is pruned at a node whose best score is still a mate, so
+        // every defence of the mated side was searched.
+        mate_found = std::abs(current_score) >= INF_SCORE - current_depth;
+        complete_root_list(cr);
+        result.pv = root_list.principal_variation();
+
         if (pid != 0) continue;
 
         // Debug output (record this data as metric for engine performance)
@@ -488,24 +713,80 @@ thc::Move MPIEngine::solve(thc::ChessRules& cr, bool is_white_player) {
         std::cout << "Depth: " <<  current_depth 
         << ", Score: " << (current_score / 100.0f) 
         << ", Time: " << elapsed_seconds.count() << "s" 
-        << ", Nodes Evaluated = " << debug_node_count 
-        << ", knps: " << (debug_node_count/1000.0) / elapsed_seconds.count() 
+        << ", Nodes Evaluated = " << iteration[search_stats::EVALUATED] 
+        << ", knps: " << (iteration[search_stats::EVALUATED]/1000.0) / elapsed_seconds.count() 
+        << ", First-move cutoffs: " << move_ordering::first_move_cutoff_rate(iteration[search_stats::FIRST_MOVE_CUTOFFS], iteration[search_stats::CUTOFFS]) << "%"
+        << ", Quiescence nodes: " << iteration[search_stats::QNODES]
+        << ", Tablebase hits: " << iteration[search_stats::TABLEBASE_HITS]
         << std::endl;
+        if (perf_counters::enabled()) {
+            std::cout << "Hardware: " << perf_counters::describe(hardware, iteration[search_stats::EVALUATED]) << std::endl;
+        }
+
+        if (telemetry::enabled()) {
+            telemetry::Iteration record;
+            record.engine = "mpi";
+            record.depth = current_depth;
+            record.score = current_score;
+            record.pv = result.pv;
+            record.seconds = elapsed_seconds.count();
+            record.branching_factor = timer.branching_factor();
+            record.counters = iteration;
+            record.workers = nodes_per_rank;
+            record.hardware = hardware;
+            telemetry::iteration(record);
+        }
     }
 
-    if (move_found) {
-        return best_move_so_far;
-    } else {
+    root_list.end(cr);
+
+#ifdef SEARCH_PROFILE
+    // Every rank timed its own share of the search: add the zones up on rank 0, which reports them
+    profile::Totals rank_profile = profile::collect();
+    profile::Totals all_ranks = rank_profile;
+    MPI_Reduce(rank_profile.cycles, all_ranks.cycles, profile::ZONE_COUNT, MPI_UINT64_T, MPI_SUM, 0, MPI_COMM_WORLD);
+    MPI_Reduce(rank_profile.calls, all_ranks.calls, profile::ZONE_COUNT, MPI_UINT64_T, MPI_SUM, 0, MPI_COMM_WORLD);
+    if (pid == 0) {
+        profile::report(all_ranks);
+    }
+#endif
+
+    // Rank 0 learns how the nodes of the whole search were shared out
+    std::vector<uint64_t> nodes_per_rank(pid == 0 ? nproc : 0);
+    MPI_Gather(&rank_nodes_searched, 1, MPI_UINT64_T, nodes_per_rank.data(), 1, MPI_UINT64_T, 0, MPI_COMM_WORLD);
+    result.workers = nodes_per_rank;
+
+    if (perf_counters::enabled()) {
+        // Each rank counted its own process: rank 0 reports them all
+        perf_counters::Values rank_hardware = perf_counters::total(perf_counters::difference(perf_counters::read(), search_counters));
+        std::vector<perf_counters::Values> hardware_per_rank(pid == 0 ? nproc : 0);
+        MPI_Gather(rank_hardware.data(), perf_counters::EVENT_COUNT, MPI_UINT64_T, hardware_per_rank.data(),
+                   perf_counters::EVENT_COUNT, MPI_UINT64_T, 0, MPI_COMM_WORLD);
+        if (pid == 0) {
+            std::cout << "Hardware, whole search: " << perf_counters::describe(perf_counters::total(hardware_per_rank), nodes_searched) << std::endl;
+            for (int rank = 0; rank < nproc; rank++) {
+                std::cout << "  Rank " << rank << ": " << perf_counters::describe(hardware_per_rank[rank], nodes_per_rank[rank]) << std::endl;
+            }
+        }
+    }
+
+    if (!move_found) {
         // If no move was found (unlikely), generate a random legal move
         std::vector<thc::Move> legal_moves;
         cr.GenLegalMoveList(legal_moves);
         if (!legal_moves.empty()) {
-            return legal_moves[0];
+            result.best_move = legal_moves[0];
         } else {
             // No legal moves, return a default move
-            return thc::Move();
+            result.best_move = thc::Move();
         }
+        result.pv.assign(1, result.best_move);
     }
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::steady_clock::now() - start_time;
+    result.nodes = nodes_searched;
+    result.time = elapsed_seconds.count();
+    return result;
 }
 
 std::pair<MPIEngine::Score, thc::Move>
@@ -516,13 +797,28 @@ MPIEngine::solve_mpi_engine(
     int max_depth,
     Score alpha_score,
     Score beta_score,
-    MPI_Comm comm
+    MPI_Comm comm,
+    bool allow_null_move,
+    const eval_kernel::BoardSummary* leaf_board
 ) {
     int pid, nproc;
 
     MPI_Comm_rank(comm, &pid);
     MPI_Comm_size(comm, &nproc);
 
+    // Once stopped, a node this rank searches alone returns at once (its score is thrown away with the iteration)
+    if (stop_requested(nproc > 1) && nproc == 1) {
+        return {0.0f, thc::Move()};
+    }
+
+    ordering.enter(depth);
+
+    // A node shared by several ranks is counted once, by the first of them
+    stats.reach(depth);
+    if (pid == 0) {
+        stats.add(search_stats::NODES);
+    }
+
     {
         thc::Move null_move;
 
@@ -531,55 +827,214 @@ MPIEngine::solve_mpi_engine(
             return {0.0f, null_move};
         }
 
+        // Mate distance pruning. The side to move can be mated here at the soonest, and can mate at the next ply at
+        // the soonest, which bounds every score below this node. If the window lies outside those bounds, a shorter
+        // mate has been found elsewhere and the node cannot change the result.
+        if (depth > 0) {
+            Score lowest = cr.white ? -(INF_SCORE - depth) : -(INF_SCORE - depth - 1);
+            Score highest = cr.white ? INF_SCORE - depth - 1 : INF_SCORE - depth;
+            alpha_score = std::max(alpha_score, lowest);
+            beta_score = std::min(beta_score, highest);
+            if (alpha_score >= beta_score) {
+                return {alpha_score, null_move};
+            }
+        }
+
         // Check for checkmate or stalemate
         thc::TERMINAL terminal;
         if (cr.Evaluate(terminal)) {
             if (terminal == thc::TERMINAL_WCHECKMATE) {
-                debug_node_count++;
+                stats.add(search_stats::EVALUATED);
                 return {-INF_SCORE + depth, null_move}; // White is checkmated
             } else if (terminal == thc::TERMINAL_BCHECKMATE) {
-                debug_node_count++;
+                stats.add(search_stats::EVALUATED);
                 return {INF_SCORE - depth, null_move}; // Black is checkmated
             } else if (terminal == thc::TERMINAL_WSTALEMATE || terminal == thc::TERMINAL_BSTALEMATE) {
-                debug_node_count++;
+                stats.add(search_stats::EVALUATED);
                 return {0.0f, null_move}; // Stalemate is a draw
             }
         }
+        // Exact result from the endgame tablebases once few enough pieces are left
+        Score tablebase_score;
+        if (depth > 0 && probe_tablebase(cr, depth, tablebase_score)) {
+            stats.add(search_stats::EVALUATED);
+            stats.add(search_stats::TABLEBASE_HITS);
+            return {tablebase_score, null_move};
+        }
+        // Nothing to gain from searching a king and pawn vs king ending the bitbase says is drawn. A won one is
+        // searched on, since which moves make progress towards promotion is for the search to find (see endgame.cpp).
+        if (depth > 0 && material_table::probe(cr.material_key).endgame == material_table::ENDGAME_KPK
+                && static_eval(cr) == 0.0f) {
+            stats.add(search_stats::EVALUATED);
+            stats.add(search_stats::TABLEBASE_HITS);
+            return {0.0f, null_move};
+        }
         if (depth == max_depth) {
-            debug_node_count++;
-            return {static_eval(cr), null_move};
+            return {quiescence(cr, depth, alpha_score, beta_score, leaf_board), null_move};
+        }
+    }
+
+    bool in_check = cr.AttackedPiece(cr.white ? cr.wking_square : cr.bking_square);
+
+    // Evaluated by the first pruning test that needs it (see evaluate_once)
+    NodeEval node_eval;
+    bool may_prune = depth > 0 && !in_check;
+
+    Score horizon_score = 0.0f;
+    bool futile = false;
+    if (may_prune && horizon_cutoff(cr, is_white_player, depth, max_depth, alpha_score, beta_score, node_eval,
+                                    horizon_score, futile)) {
+        return {horizon_score, thc::Move()};
+    }
+
+    if (allow_null_move && may_prune
+            && null_move_cutoff(cr, is_white_player, depth, max_depth, alpha_score, beta_score, node_eval, comm)) {
+        if (pid == 0) {
+            stats.add(search_stats::NULL_MOVE_CUTOFFS);
         }
+        return {is_white_player ? alpha_score : beta_score, thc::Move()};
     }
 
     std::vector<thc::Move> legal_moves;
     cr.GenLegalMoveList(legal_moves);
 
-    // Assign scores to moves
+    // Assign scores to moves. The root takes them in the order of its move list instead (see root-moves.h): the
+    // first nproc moves, the ones expected to matter most, are the first each rank searches.
     std::vector<std::pair<float, thc::Move>> scored_moves;
-    for (const auto& move : legal_moves) {
-        float score = score_move(move, cr);
-        scored_moves.emplace_back(score, move);
-    }
+    if (depth == 0) {
+        for (const auto& root_move : root_list.moves()) {
+            scored_moves.emplace_back(0.0f, root_move.move);
+        }
+    } else {
+        PROFILE_ZONE(profile::MOVE_ORDERING);
+        for (const auto& move : legal_moves) {
+            float score = score_move(move, cr, depth);
+            scored_moves.emplace_back(score, move);
+        }
 
-    // Sort moves by descending score using a custom comparator
-    std::sort(scored_moves.begin(), scored_moves.end(), [](const std::pair<float, thc::Move>& a, const std::pair<float, thc::Move>& b) {
-        return a.first > b.first;
-    });
+        // Sort moves by descending score using a custom comparator
+        std::sort(scored_moves.begin(), scored_moves.end(), [](const std::pair<float, thc::Move>& a, const std::pair<float, thc::Move>& b) {
+            return a.first > b.first;
+        });
+    }
 
 
     std::pair<MPIEngine::Score, thc::Move> ans_pair;
 
+    // Plies to take off the search of the move_number-th move in the ordering, already played on child, or -1 if
+    // it is pruned. A capture that loses material is searched a ply shallower; late quiet moves that give no check
+    // are reduced by the late move table, and pruned near the leaves when allowed. Reduced moves are searched
+    // again at full depth only if they turn out better than the moves before them (here is_white_player is the
+    // side minimising the score).
+    int remaining = max_depth - depth;
+    auto reduction = [&](const thc::Move& move, int move_number, thc::ChessRules& child, bool allow_pruning) {
+        int plies = 0;
+        if (remaining >= BAD_CAPTURE_REDUCTION_DEPTH && move.capture != ' ' && !in_check
+            && see::evaluate(cr, move) < 0) {
+            plies = 1;
+        }
+        bool quiet = move_ordering::is_quiet(move);
+        bool good_history = quiet && ordering.history_score(move, cr.white) >= late_moves::GOOD_HISTORY;
+        bool late = depth > 0 && quiet && !in_check && move_number >= late_moves::FULL_DEPTH_MOVES
+                    && !ordering.is_killer(move, depth)
+                    && !child.AttackedPiece(child.white ? child.wking_square : child.bking_square);
+        if (allow_pruning && late && remaining <= late_moves::PRUNING_MAX_DEPTH && !good_history
+            && move_number >= late_moves::pruning_limit(remaining)) {
+            return -1;
+        }
+        if (late && remaining >= late_moves::REDUCTION_MIN_DEPTH) {
+            plies = std::max(late_moves::reduction(remaining, move_number) - good_history, 0);
+        }
+        return std::min(plies, remaining - 1);
+    };
+    auto improves = [&](Score score) {
+        return is_white_player ? score < beta_score : score > alpha_score;
+    };
+
+    // A ply above the leaves, every child searched is a leaf (nothing is reduced with one ply left), and its
+    // quiescence search starts from its static eval. So the children this rank will search of its share of the
+    // moves are summarised together from this node's summary, a batch at a time. Killers and history do not
+    // change during the loop until the cutoff that ends it, so the pruning tests decide as in the loop unless the
+    // rank's best score has since left or entered the mates (prunable below). A child planned then is summarised
+    // for nothing, or searched without one. Only quiet moves are ever skipped, and only from the move count that
+    // allows late move pruning unless the node is futile.
+    LeafBatch leaves;
+    auto plan_leaves = [&](int from, bool prunable) {
+        if (!leaves.board_known) {
+            eval_kernel::summarise(cr.squares, leaves.board);
+            leaves.board_known = true;
+        }
+        eval_kernel::ChildBatch batch;
+        int k = from;
+        for (; k < (int)scored_moves.size() && batch.count < eval_kernel::BATCH_SIZE; k += nproc) {
+            thc::Move& move = scored_moves[k].second;
+            bool searched = true;
+            if (prunable && move_ordering::is_quiet(move) && (futile || k >= late_moves::pruning_limit(remaining))) {
+                thc::ChessRules child = cr;
+                child.PushMove(move);
+                bool gives_check = child.AttackedPiece(child.white ? child.wking_square : child.bking_square);
+                searched = (!futile || gives_check) && reduction(move, k, child, true) >= 0;
+            }
+            if (searched) {
+                leaves.index[batch.count] = k;
+                eval_kernel::add_child(batch, cr.squares, move);
+            }
+        }
+        leaves.planned = k;
+        leaves.count = batch.count;
+        leaves.next = 0;
+        eval_kernel::summarise_children(leaves.board, batch, leaves.children);
+    };
+
     if (nproc <= legal_moves.size()) {
         MPI_Comm my_comm;
         MPI_Comm_split(comm, pid, pid, &my_comm);
         // only contains me in the subset
         bool found = false;
 
-        for (int i=pid;i<scored_moves.size();i+=nproc) {
+        for (int i=pid, j=0;i<scored_moves.size();i+=nproc, j++) {
+            // No move is pruned while this rank's best score is still a mate: until one of its moves escapes the
+            // mate, a pruned move may be the only one that does, and the node would return a mate it has not
+            // proven. The first move of each rank is always searched.
+            bool prunable = found && std::abs(ans_pair.first) < MATE_BOUND;
+
+            const eval_kernel::BoardSummary* leaf = nullptr;
+            if (remaining == 1) {
+                if ((size_t)i >= leaves.planned) {
+                    plan_leaves(i, prunable);
+                }
+                if (leaves.next < leaves.count && leaves.index[leaves.next] == (size_t)i) {
+                    leaf = &leaves.children[leaves.next++];
+                }
+            }
+
+            uint64_t nodes_before = ordering.nodes;
             thc::ChessRules cr_copy = cr;
             cr_copy.PushMove(scored_moves[i].second);
+            if (depth < move_ordering::MAX_PLY) {
+                ordering.played[depth] = scored_moves[i].second;
+            }
 
-            auto curr_ans = solve_mpi_engine(cr_copy, !is_white_player, depth+1, max_depth, alpha_score, beta_score, my_comm);
+            // At a futile node, quiet moves that give no check are worth horizon_score without a search
+            std::pair<MPIEngine::Score, thc::Move> curr_ans = {horizon_score, scored_moves[i].second};
+            if (!prunable || !futile || !move_ordering::is_quiet(scored_moves[i].second)
+                    || cr_copy.AttackedPiece(cr_copy.white ? cr_copy.wking_square : cr_copy.bking_square)) {
+                int plies = reduction(scored_moves[i].second, i, cr_copy, prunable);
+                if (plies < 0) {
+                    stats.add(search_stats::PRUNED_MOVES);
+                    continue;
+                }
+                curr_ans = solve_mpi_engine(cr_copy, !is_white_player, depth+1, max_depth - plies, alpha_score, beta_score,
+                                            my_comm, true, leaf);
+                if (plies > 0 && improves(curr_ans.first)) {
+                    curr_ans = solve_mpi_engine(cr_copy, !is_white_player, depth+1, max_depth, alpha_score, beta_score, my_comm);
+                }
+            } else {
+                stats.add(search_stats::PRUNED_MOVES);
+            }
+            if (depth == 0) {
+                root_list.record(scored_moves[i].second, curr_ans.first, ordering.nodes - nodes_before);
+            }
             if (!found) {
                 ans_pair = curr_ans;
                 found = true;
@@ -599,17 +1054,25 @@ MPIEngine::solve_mpi_engine(
             if (is_white_player) {
                 beta_score = std::min(beta_score, ans_pair.first);
                 if (beta_score <= alpha_score) {
+                    stats.add_cutoff(j);
+                    ordering.update_cutoff(scored_moves[i].second, depth, cr.white, max_depth - depth);
                     break;
                     // (no pruning) 
                 }
             } else {
                 alpha_score = std::max(alpha_score, ans_pair.first);
                 if (beta_score <= alpha_score) {
+                    stats.add_cutoff(j);
+                    ordering.update_cutoff(scored_moves[i].second, depth, cr.white, max_depth - depth);
                     break;
                     // (no pruning)
                 }
             }
         }
+        // Every one of my moves was pruned: take no part in the reduction below
+        if (!found) {
+            ans_pair = {is_white_player ? INF_SCORE : -INF_SCORE, scored_moves[pid].second};
+        }
         
         MPI_Comm_free(&my_comm);
     }
@@ -618,11 +1081,24 @@ MPIEngine::solve_mpi_engine(
         int my_move_ind = pid % scored_moves.size();
         MPI_Comm_split(comm, my_move_ind, pid, &my_comm);
 
+        uint64_t nodes_before = ordering.nodes;
         thc::ChessRules cr_copy = cr;
         cr_copy.PushMove(scored_moves[my_move_ind].second);
+        if (depth < move_ordering::MAX_PLY) {
+            ordering.played[depth] = scored_moves[my_move_ind].second;
+        }
 
-        ans_pair = solve_mpi_engine(cr_copy, !is_white_player, depth+1, max_depth, alpha_score, beta_score, my_comm);
+        // A group with a single move has nothing better to do than search it, so it is reduced but never pruned,
+        // by move count or by futility
+        int plies = reduction(scored_moves[my_move_ind].second, my_move_ind, cr_copy, false);
+        ans_pair = solve_mpi_engine(cr_copy, !is_white_player, depth+1, max_depth - plies, alpha_score, beta_score, my_comm);
+        if (plies > 0 && improves(ans_pair.first)) {
+            ans_pair = solve_mpi_engine(cr_copy, !is_white_player, depth+1, max_depth, alpha_score, beta_score, my_comm);
+        }
         ans_pair.second = scored_moves[my_move_ind].second;
+        if (depth == 0) {
+            root_list.record(ans_pair.second, ans_pair.first, ordering.nodes - nodes_before);
+        }
 
         MPI_Comm_free(&my_comm);
     }
@@ -630,10 +1106,15 @@ MPIEngine::solve_mpi_engine(
     std::pair<MPIEngine::Score, thc::Move> best_ans;
 
     if (is_white_player) {
-        MPI_Allreduce(&ans_pair, &best_ans, 1, MPI_FLOAT_INT, MPI_MINLOC, comm);
+        best_ans = reduce_best(ans_pair, MPI_MINLOC, comm);
     }
     else {
-        MPI_Allreduce(&ans_pair, &best_ans, 1, MPI_FLOAT_INT, MPI_MAXLOC, comm);
+        best_ans = reduce_best(ans_pair, MPI_MAXLOC, comm);
+    }
+
+    // The line behind the best move stays with the rank that searched it, the root list only learns the move
+    if (depth == 0) {
+        root_list.record_pv(&best_ans.second, 1);
     }
 
     return best_ans;
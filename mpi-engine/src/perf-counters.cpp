@@ -0,0 +1,234 @@
+/*
+ *  perf-counters
+ *
+ *  See perf-counters.h. Each event is opened on its own rather than as a group, so that a machine without one
+ *  of them still counts the rest. The file descriptors of a slot are closed only when another thread takes it
+ *  over; a thread that exits keeps its final counts readable.
+ */
+
+#include "perf-counters.h"
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <thread>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace perf_counters {
+
+namespace {
+
+struct Slot {
+    std::thread::id owner;
+    int fd[EVENT_COUNT];
+};
+
+std::mutex mutex;
+std::vector<Slot> slots;
+bool is_enabled = false;
+bool is_available[EVENT_COUNT] = {};
+
+#ifdef __linux__
+
+// The kernel's name for each event
+void describe_event(Event event, perf_event_attr& attr) {
+    switch (event) {
+    case CYCLES:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CPU_CYCLES;
+        break;
+    case INSTRUCTIONS:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+        break;
+    case L1D_MISSES:
+        attr.type = PERF_TYPE_HW_CACHE;
+        attr.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                    | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+        break;
+    case LLC_MISSES:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        break;
+    case BRANCH_MISSES:
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+        break;
+    default:
+        attr.type = PERF_TYPE_SOFTWARE;
+        attr.config = PERF_COUNT_SW_TASK_CLOCK;
+        break;
+    }
+}
+
+// Count event on the calling thread, -1 if it cannot be
+int open_event(Event event) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    describe_event(event, attr);
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+
+uint64_t read_event(int fd) {
+    uint64_t data[3];   // value, time enabled, time running
+    if (fd < 0 || ::read(fd, data, sizeof(data)) != (ssize_t)sizeof(data) || data[2] == 0) {
+        return 0;
+    }
+    // Scale up a count the kernel multiplexed with others
+    if (data[2] < data[1]) {
+        return (uint64_t)((double)data[0] * data[1] / data[2]);
+    }
+    return data[0];
+}
+
+void close_event(int fd) {
+    if (fd >= 0) {
+        ::close(fd);
+    }
+}
+
+#else
+
+int open_event(Event) { errno = ENOSYS; return -1; }
+uint64_t read_event(int) { return 0; }
+void close_event(int) {}
+
+#endif // __linux__
+
+// Open the available events for the calling thread in slot; the caller holds the mutex
+void open_slot(int slot) {
+    if ((int)slots.size() <= slot) {
+        Slot unused;
+        for (int event = 0; event < EVENT_COUNT; event++) {
+            unused.fd[event] = -1;
+        }
+        slots.resize(slot + 1, unused);
+    }
+    Slot& counting = slots[slot];
+    for (int event = 0; event < EVENT_COUNT; event++) {
+        close_event(counting.fd[event]);
+        counting.fd[event] = is_available[event] ? open_event(Event(event)) : -1;
+    }
+    counting.owner = std::this_thread::get_id();
+}
+
+} // namespace
+
+bool open(std::string& error) {
+    std::lock_guard<std::mutex> lock(mutex);
+    int reason = 0;
+    bool any = false;
+    for (int event = 0; event < EVENT_COUNT; event++) {
+        int fd = open_event(Event(event));
+        is_available[event] = fd >= 0;
+        if (fd >= 0) {
+            any = true;
+            close_event(fd);
+        } else if (!reason) {
+            reason = errno;
+        }
+    }
+    if (!any) {
+        error = std::strerror(reason);
+        return false;
+    }
+    is_enabled = true;
+    open_slot(0);
+    return true;
+}
+
+bool enabled() {
+    return is_enabled;
+}
+
+bool available(Event event) {
+    return is_available[event];
+}
+
+void attach(int slot) {
+    if (!is_enabled) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex);
+    if (slot < (int)slots.size() && slots[slot].owner == std::this_thread::get_id()) {
+        return;
+    }
+    open_slot(slot);
+}
+
+std::vector<Values> read() {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<Values> counts(slots.size());
+    for (size_t slot = 0; slot < slots.size(); slot++) {
+        for (int event = 0; event < EVENT_COUNT; event++) {
+            counts[slot][event] = read_event(slots[slot].fd[event]);
+        }
+    }
+    return counts;
+}
+
+Values difference(const Values& later, const Values& earlier) {
+    Values counts;
+    for (int event = 0; event < EVENT_COUNT; event++) {
+        // Less than before: the slot was taken over and counts from zero
+        counts[event] = later[event] >= earlier[event] ? later[event] - earlier[event] : later[event];
+    }
+    return counts;
+}
+
+std::vector<Values> difference(const std::vector<Values>& later, const std::vector<Values>& earlier) {
+    std::vector<Values> counts(later.size());
+    for (size_t slot = 0; slot < later.size(); slot++) {
+        counts[slot] = slot < earlier.size() ? difference(later[slot], earlier[slot]) : later[slot];
+    }
+    return counts;
+}
+
+Values total(const std::vector<Values>& per_slot) {
+    Values sum{};
+    for (const Values& counts : per_slot) {
+        for (int event = 0; event < EVENT_COUNT; event++) {
+            sum[event] += counts[event];
+        }
+    }
+    return sum;
+}
+
+std::string describe(const Values& counts, uint64_t nodes) {
+    std::string text;
+    char item[64];
+    auto add = [&](const char* format, double value) {
+        std::snprintf(item, sizeof(item), format, value);
+        text += text.empty() ? "" : ", ";
+        text += item;
+    };
+
+    if (available(CYCLES) && available(INSTRUCTIONS) && counts[CYCLES] > 0) {
+        add("IPC %.2f", (double)counts[INSTRUCTIONS] / counts[CYCLES]);
+    }
+    if (nodes > 0) {
+        if (available(CYCLES)) add("cycles/node %.0f", (double)counts[CYCLES] / nodes);
+        if (available(L1D_MISSES)) add("L1d misses/node %.2f", (double)counts[L1D_MISSES] / nodes);
+        if (available(LLC_MISSES)) add("LLC misses/node %.3f", (double)counts[LLC_MISSES] / nodes);
+        if (available(BRANCH_MISSES)) add("branch misses/node %.2f", (double)counts[BRANCH_MISSES] / nodes);
+    }
+    if (available(TASK_CLOCK)) {
+        add("CPU %.3fs", counts[TASK_CLOCK] / 1e9);
+    }
+    return text;
+}
+
+const char* usage() {
+    return "[--perf-counters]";
+}
+
+} // namespace perf_counters
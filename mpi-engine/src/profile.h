@@ -0,0 +1,89 @@
+#ifndef PROFILE_H
+#define PROFILE_H
+
+/*
+ *  profile
+ *
+ *  Where the time of a search goes, without an external profiler. The hot functions of the search open a zone
+ *  with PROFILE_ZONE, which reads the time stamp counter on the way in and on the way out and adds the difference
+ *  to the zone's total on the calling thread. A zone entered inside another is taken off the outer one, so each
+ *  zone is charged only its own time (exclusive time) and the zones add up to the search.
+ *
+ *  solve() calls begin() when it starts and prints report(collect()) when it is done: the share of the search
+ *  spent in each zone, in cycles, with the calls and cycles per call, added up over the threads.
+ *
+ *  Zones are built only with SEARCH_PROFILE defined (make PROFILE=1, after a make clean). Otherwise PROFILE_ZONE
+ *  expands to nothing and the rest are empty inline functions, so the search is the same code as without it.
+ *  A zone costs two counter reads itself, which shows most in the smallest ones (PushMove and PopMove): the
+ *  breakdown is for comparing builds and positions, not for absolute cycle counts.
+ */
+
+#include <cstdint>
+
+namespace profile {
+
+enum Zone {
+    MOVE_GENERATION,    // ChessRules::GenLegalMoveList
+    MAKE_MOVE,          // ChessRules::PushMove and PopMove
+    DRAW_DETECTION,     // ChessRules::IsDraw
+    TERMINAL_CHECK,     // ChessRules::Evaluate, checkmate and stalemate
+    MOVE_ORDERING,      // score_move and the sort of a node's moves
+    STATIC_EVAL,        // the engine's static evaluation, once the board is summarised
+    ZONE_COUNT
+};
+
+constexpr const char* ZONE_NAMES[ZONE_COUNT] = {
+    "GenLegalMoveList", "PushMove/PopMove", "IsDraw", "Evaluate", "score_move/sort", "static_eval"
+};
+
+// Zone totals of every thread together
+struct Totals {
+    uint64_t cycles[ZONE_COUNT] = {};
+    uint64_t calls[ZONE_COUNT] = {};
+    uint64_t search_cycles = 0;     // since begin()
+};
+
+#ifdef SEARCH_PROFILE
+
+// Clear every thread's totals and start timing a search
+void begin();
+
+// Add up the threads' totals; the threads must not be in a zone
+Totals collect();
+
+// Print the breakdown of a search to std::cout
+void report(const Totals& totals);
+
+uint64_t ticks();
+
+class ScopedZone {
+public:
+    explicit ScopedZone(Zone zone);
+    ~ScopedZone();
+
+    ScopedZone(const ScopedZone&) = delete;
+    ScopedZone& operator=(const ScopedZone&) = delete;
+
+private:
+    Zone zone;
+    int parent;             // zone this one was entered from, -1 for none
+    uint64_t start;
+};
+
+#define PROFILE_CONCAT_(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_(a, b)
+#define PROFILE_ZONE(zone) profile::ScopedZone PROFILE_CONCAT(profile_zone_, __LINE__)(zone)
+
+#else
+
+inline void begin() {}
+inline Totals collect() { return Totals(); }
+inline void report(const Totals&) {}
+
+#define PROFILE_ZONE(zone) ((void)0)
+
+#endif // SEARCH_PROFILE
+
+} // namespace profile
+
+#endif // PROFILE_H
@@ -0,0 +1,60 @@
+/* search-bench.cpp
+ *
+ *  Fixed-depth search of the positions in bench-positions.h, for scaling-bench.sh. Every rank searches, rank 0
+ *  prints one CSV line per position (the engine's own search output is kept off standard output):
+ *
+ *      engine,workers,position,depth,seconds,nodes,worker_nodes
+ *
+ *  where worker_nodes has the nodes of each rank, separated by spaces. Build with "make search-bench", run with
+ *  mpirun -np RANKS ./search-bench [depth].
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <mpi.h>
+#include "thc.h"
+#include "bench-positions.h"
+#include "mpi-engine.h"
+
+int main(int argc, char* argv[]) {
+    MPI_Init(&argc, &argv);
+    int pid, nproc;
+    MPI_Comm_rank(MPI_COMM_WORLD, &pid);
+    MPI_Comm_size(MPI_COMM_WORLD, &nproc);
+
+    int depth = argc > 1 ? std::atoi(argv[1]) : 7;
+    if (depth < 1 || depth > search_limits::MAX_SEARCH_DEPTH) {
+        if (pid == 0) std::fprintf(stderr, "Usage: %s [depth]\n", argv[0]);
+        MPI_Finalize();
+        return 1;
+    }
+
+    MPIEngine engine;
+    search_limits::SearchLimits limits;
+    limits.depth = depth;
+
+    for (int position = 0; position < bench_positions::COUNT; position++) {
+        thc::ChessRules cr;
+        cr.Forsyth(bench_positions::FENS[position]);
+
+        std::streambuf* output = std::cout.rdbuf(nullptr);
+        search_limits::SearchResult result = engine.solve(cr, cr.WhiteToPlay(), limits);
+        std::cout.rdbuf(output);
+        std::cout.clear();
+
+        if (pid != 0) continue;
+
+        std::string worker_nodes;
+        for (uint64_t nodes : result.workers) {
+            worker_nodes += (worker_nodes.empty() ? "" : " ") + std::to_string(nodes);
+        }
+        std::printf("mpi,%d,%d,%d,%.6f,%llu,%s\n", nproc, position, result.depth, result.time,
+                    (unsigned long long)result.nodes, worker_nodes.c_str());
+        std::fflush(stdout);
+    }
+
+    MPI_Finalize();
+    return 0;
+}
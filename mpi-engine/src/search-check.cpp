@@ -0,0 +1,74 @@
+/* search-check.cpp
+ *
+ *  Searches the positions in check-positions.h to their depth, and checks every mate the search reports against
+ *  a full-width search of the same length: the mate must be forced, and the search may stop short of the depth
+ *  only on such a mate. Every rank searches, rank 0 checks and prints one line per position, and fails if any is
+ *  wrong. Build and run with "make check [MPIRUN=...]".
+ */
+
+#include <mpi.h>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+#include <vector>
+#include "thc.h"
+#include "check-positions.h"
+#include "mpi-engine.h"
+
+// Whether the side attacker_white mates in at most plies, by trying every move
+static bool forced_mate(thc::ChessRules& cr, int plies, bool attacker_white) {
+    std::vector<thc::Move> moves;
+    cr.GenLegalMoveList(moves);
+    if (moves.empty()) {
+        return cr.white != attacker_white && cr.AttackedPiece(cr.white ? cr.wking_square : cr.bking_square);
+    }
+    if (plies == 0) {
+        return false;
+    }
+    bool attacking = cr.white == attacker_white;
+    for (thc::Move move : moves) {
+        cr.PushMove(move);
+        bool mate = forced_mate(cr, plies - 1, attacker_white);
+        cr.PopMove(move);
+        if (mate == attacking) {
+            return mate;
+        }
+    }
+    return !attacking;
+}
+
+int main(int argc, char* argv[]) {
+    MPI_Init(&argc, &argv);
+    int pid;
+    MPI_Comm_rank(MPI_COMM_WORLD, &pid);
+
+    MPIEngine engine;
+    int wrong = 0;
+
+    for (int position = 0; position < check_positions::COUNT; position++) {
+        const check_positions::Position& check = check_positions::POSITIONS[position];
+        thc::ChessRules cr;
+        cr.Forsyth(check.fen);
+        search_limits::SearchLimits limits;
+        limits.depth = check.depth;
+
+        // The engine's is_white_player is the side minimising the score
+        std::streambuf* output = std::cout.rdbuf(nullptr);
+        search_limits::SearchResult result = engine.solve(cr, !cr.WhiteToPlay(), limits);
+        std::cout.rdbuf(output);
+        std::cout.clear();
+        if (pid != 0) continue;
+
+        bool ok = result.depth == check.depth;
+        if (std::fabs(result.score) >= MPIEngine::MATE_BOUND) {
+            int plies = (int)std::lround(MPIEngine::INF_SCORE - std::fabs(result.score));
+            ok = plies <= result.depth && forced_mate(cr, plies, result.score > 0);
+        }
+        std::printf("%-64s depth %d/%d score %10.2f %s\n", check.fen, result.depth, check.depth,
+                    result.score / 100.0f, ok ? "ok" : "WRONG");
+        wrong += !ok;
+    }
+
+    MPI_Finalize();
+    return wrong > 0;
+}
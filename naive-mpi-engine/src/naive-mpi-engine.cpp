@@ -13,6 +13,7 @@
 #include <iostream>
 
 #include <utility>
+#include <thread>
 #include <cassert>
 
 void print(){std::cout<<std::endl;}
@@ -24,73 +25,6 @@ void print(const T &t, TAIL... tail)
     print(tail...);
 }
 
-// Piece-square tables for evaluation (a.k.a. heat maps)
-const int pawn_table[64] = {
-     0,  0,  0,  0,  0,  0,  0,  0,
-    50, 50, 50, 50, 50, 50, 50, 50,
-    10, 10, 20, 30, 30, 20, 10, 10,
-     5,  5, 10, 25, 25, 10,  5,  5,
-     0,  0,  0, 20, 20,  0,  0,  0,
-     5, -5,-10,  0,  0,-10, -5,  5,
-     5, 10, 10,-20,-20, 10, 10,  5,
-     0,  0,  0,  0,  0,  0,  0,  0
-};
-
-const int knight_table[64] = {
-    -50,-40,-30,-30,-30,-30,-40,-50,
-    -40,-20,  0,  0,  0,  0,-20,-40,
-    -30,  0, 10, 15, 15, 10,  0,-30,
-    -30,  5, 15, 20, 20, 15,  5,-30,
-    -30,  0, 15, 20, 20, 15,  0,-30,
-    -30,  5, 10, 15, 15, 10,  5,-30,
-    -40,-20,  0,  5,  5,  0,-20,-40,
-    -50,-40,-30,-30,-30,-30,-40,-50
-};
-
-const int bishop_table[64] = {
-    -20,-10,-10,-10,-10,-10,-10,-20,
-    -10,  0,  0,  0,  0,  0,  0,-10,
-    -10,  0,  5, 10, 10,  5,  0,-10,
-    -10,  5,  5, 10, 10,  5,  5,-10,
-    -10,  0, 10, 10, 10, 10,  0,-10,
-    -10, 10, 10, 10, 10, 10, 10,-10,
-    -10,  5,  0,  0,  0,  0,  5,-10,
-    -20,-10,-10,-10,-10,-10,-10,-20
-};
-
-const int rook_table[64] = {
-     0,  0,  0,  0,  0,  0,  0,  0,
-     5, 10, 10, 10, 10, 10, 10,  5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-     0,  0,  0,  5,  5,  0,  0,  0
-};
-
-const int queen_table[64] = {
-    -20,-10,-10, -5, -5,-10,-10,-20,
-    -10,  0,  0,  0,  0,  0,  0,-10,
-    -10,  0,  5,  5,  5,  5,  0,-10,
-     -5,  0,  5,  5,  5,  5,  0, -5,
-      0,  0,  5,  5,  5,  5,  0, -5,
-    -10,  5,  5,  5,  5,  5,  0,-10,
-    -10,  0,  5,  0,  0,  0,  0,-10,
-    -20,-10,-10, -5, -5,-10,-10,-20
-};
-
-const int king_table[64] = {
-    -30,-40,-40,-50,-50,-40,-40,-30,
-    -30,-40,-40,-50,-50,-40,-40,-30,
-    -30,-40,-40,-50,-50,-40,-40,-30,
-    -30,-40,-40,-50,-50,-40,-40,-30,
-    -20,-30,-30,-40,-40,-30,-30,-20,
-    -10,-20,-20,-20,-20,-20,-20,-10,
-     20, 20,  0,  0,  0,  0, 20, 20,
-     20, 30, 10,  0,  0, 10, 30, 20
-};
-
 /* Helper function for move scoring. Capturing larger piece is prioritized first.
  */
 
@@ -118,36 +52,13 @@ float NaiveMPIEngine::score_move(const thc::Move& move, thc::ChessRules& cr) {
     // Positional gain
     int from_index = static_cast<int>(move.src);
     int to_index = static_cast<int>(move.dst);
-    char piece = cr.squares[from_index];
-
-    if (isupper(piece)) { // White pieces
-        switch (piece) {
-            case 'P': score += (pawn_table[to_index] - pawn_table[from_index]) / 100.0f; break;
-            case 'N': score += (knight_table[to_index] - knight_table[from_index]) / 100.0f; break;
-            case 'B': score += (bishop_table[to_index] - bishop_table[from_index]) / 100.0f; break;
-            case 'R': score += (rook_table[to_index] - rook_table[from_index]) / 100.0f; break;
-            case 'Q': score += (queen_table[to_index] - queen_table[from_index]) / 100.0f; break;
-            case 'K': score += (king_table[to_index] - king_table[from_index]) / 100.0f; break;
-        }
-    } else { // Black pieces
-        int flipped_from_index = 63 - from_index;
-        int flipped_to_index = 63 - to_index;
-
-        switch (piece) {
-            case 'p': score += (pawn_table[flipped_to_index] - pawn_table[flipped_from_index]) / 100.0f; break;
-            case 'n': score += (knight_table[flipped_to_index] - knight_table[flipped_from_index]) / 100.0f; break;
-            case 'b': score += (bishop_table[flipped_to_index] - bishop_table[flipped_from_index]) / 100.0f; break;
-            case 'r': score += (rook_table[flipped_to_index] - rook_table[flipped_from_index]) / 100.0f; break;
-            case 'q': score += (queen_table[flipped_to_index] - queen_table[flipped_from_index]) / 100.0f; break;
-            case 'k': score += (king_table[flipped_to_index] - king_table[flipped_from_index]) / 100.0f; break;
-        }
-    }
+    score += eval_kernel::psqt_delta(cr.squares[from_index], from_index, to_index) / 100.0f;
 
     return score;
 }
 
 // Add a mobility bonus for the pieces (not sure if this helps).
-int NaiveMPIEngine::evaluate_mobility(thc::ChessRules& cr, bool is_white, const std::vector<int>& piece_indices) {
+int NaiveMPIEngine::evaluate_mobility(thc::ChessRules& cr, bool is_white) {
     int mobility_score = 0;
     thc::ChessRules cr_copy = cr;
     std::vector<thc::Move> moves;
@@ -170,13 +81,13 @@ int NaiveMPIEngine::evaluate_mobility(thc::ChessRules& cr, bool is_white, const
     return mobility_score;
 }
 
-int NaiveMPIEngine::evaluate_pawn_structure(const std::vector<int>& pawn_files, bool is_white) {
+int NaiveMPIEngine::evaluate_pawn_structure(uint64_t pawns, bool is_white) {
     int score = 0;
 
     // Count pawns on each file
     int file_counts[8] = {0};
-    for (int file : pawn_files) {
-        file_counts[file]++;
+    for (int i = 0; i < 8; ++i) {
+        file_counts[i] = __builtin_popcountll(pawns & (0x0101010101010101ULL << i));
     }
 
     // Evaluate pawn structure
@@ -289,144 +200,44 @@ int NaiveMPIEngine::evaluate_king_activity(int own_king_index, int opponent_king
 }
 
 
-const int ENDGAME_MATERIAL_THRESHOLD = 2400; // Adjust based on testing
-
-bool NaiveMPIEngine::is_endgame(int white_material, int black_material) {
-    int total_material = white_material + black_material;
-    return total_material <= ENDGAME_MATERIAL_THRESHOLD; // Define a threshold, e.g., 2400 (two rooks)
+NaiveMPIEngine::Score NaiveMPIEngine::static_eval(thc::ChessRules& cr) {
+    // Evaluate material and positional bonuses for the whole board at once (see eval-kernel.h)
+    eval_kernel::BoardSummary board;
+    eval_kernel::summarise(cr.squares, board);
+    return static_eval(cr, board);
 }
 
-NaiveMPIEngine::Score NaiveMPIEngine::static_eval(thc::ChessRules& cr) {
-    Score total_score = 0.0f;
+NaiveMPIEngine::Score NaiveMPIEngine::static_eval(thc::ChessRules& cr, const eval_kernel::BoardSummary& board) {
+    PROFILE_ZONE(profile::STATIC_EVAL);
+    Score total_score = board.material_pst;
 
-    // Material counts
-    int white_material = 0;
-    int black_material = 0;
+    // Game phase, scaling and endgame type for this material (see material-table.h)
+    material_table::Entry material = material_table::probe(cr.material_key);
 
-    // Piece counts for bishop pair evaluation
-    int white_bishops = 0;
-    int black_bishops = 0;
+    // Specialised endgames (KPK, KQK, KRK, KBNK, KRKP) have an evaluator of their own (see endgame.h)
+    if (material.endgame != material_table::ENDGAME_NONE) {
+        return endgame::evaluate(material.endgame, board, material.strong_white, cr.WhiteToPlay());
+    }
 
     // King positions
-    int white_king_index = -1;
-    int black_king_index = -1;
-
-    // Variables for pawn structure
-    std::vector<int> white_pawn_files;
-    std::vector<int> black_pawn_files;
-
-    // Piece positions for mobility evaluation
-    std::vector<int> white_piece_indices;
-    std::vector<int> black_piece_indices;
-
-    // Evaluate material and positional bonuses
-    for (int i = 0; i < 64; i++) {
-        char piece = cr.squares[i];
-        if (piece == ' ')
-            continue;
-
-        int index = i;
-        int flipped_index = 63 - i; // Flips the board for Black
-        int piece_value = 0;
-        float positional_bonus = 0.0f;
-
-        bool is_white = isupper(piece);
-        char lower_piece = tolower(piece);
-
-        switch (lower_piece) {
-            case 'p':
-                piece_value = 100;
-                positional_bonus = pawn_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_pawn_files.push_back(index % 8);
-                } else {
-                    black_material += piece_value;
-                    black_pawn_files.push_back(index % 8);
-                }
-                break;
-            case 'n':
-                piece_value = 320;
-                positional_bonus = knight_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_piece_indices.push_back(index);
-                } else {
-                    black_material += piece_value;
-                    black_piece_indices.push_back(index);
-                }
-                break;
-            case 'b':
-                piece_value = 330;
-                positional_bonus = bishop_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_bishops++;
-                    white_piece_indices.push_back(index);
-                } else {
-                    black_material += piece_value;
-                    black_bishops++;
-                    black_piece_indices.push_back(index);
-                }
-                break;
-            case 'r':
-                piece_value = 500;
-                positional_bonus = rook_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_piece_indices.push_back(index);
-                } else {
-                    black_material += piece_value;
-                    black_piece_indices.push_back(index);
-                }
-                break;
-            case 'q':
-                piece_value = 900;
-                positional_bonus = queen_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_piece_indices.push_back(index);
-                } else {
-                    black_material += piece_value;
-                    black_piece_indices.push_back(index);
-                }
-                break;
-            case 'k':
-                piece_value = 20000; // High value for the King
-                positional_bonus = king_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_king_index = index;
-                } else {
-                    black_king_index = index;
-                }
-                break;
-            default:
-                break;
-        }
-
-        Score square_score = piece_value + positional_bonus;
-        if (is_white) {
-            total_score += square_score;
-        } else {
-            total_score -= square_score;
-        }
-    }
+    int white_king_index = eval_kernel::king_square(board, true);
+    int black_king_index = eval_kernel::king_square(board, false);
 
     // Bishop pair bonus
-    if (white_bishops >= 2) total_score += 50;
-    if (black_bishops >= 2) total_score -= 50;
+    if (eval_kernel::piece_count(board, eval_kernel::WB) >= 2) total_score += 50;
+    if (eval_kernel::piece_count(board, eval_kernel::BB) >= 2) total_score -= 50;
 
     // Mobility evaluation
-    total_score += evaluate_mobility(cr, true, white_piece_indices);
-    total_score -= evaluate_mobility(cr, false, black_piece_indices);
+    total_score += evaluate_mobility(cr, true);
+    total_score -= evaluate_mobility(cr, false);
 
     // Pawn structure evaluation
-    total_score += evaluate_pawn_structure(white_pawn_files, true);
-    total_score -= evaluate_pawn_structure(black_pawn_files, false);
+    total_score += evaluate_pawn_structure(board.bitboards[eval_kernel::WP], true);
+    total_score -= evaluate_pawn_structure(board.bitboards[eval_kernel::BP], false);
 
     // King safety evaluation
 
-    bool endgame = is_endgame(white_material, black_material);
+    bool endgame = material.flags & material_table::ENDGAME;
 
     total_score += evaluate_king_safety(cr, white_king_index, true, endgame);
     total_score -= evaluate_king_safety(cr, black_king_index, false, endgame);
@@ -439,30 +250,112 @@ NaiveMPIEngine::Score NaiveMPIEngine::static_eval(thc::ChessRules& cr) {
         total_score -= evaluate_king_activity(black_king_index, white_king_index, false);
     }
 
+    // Pull the score towards a draw when the side ahead lacks the material to win
+    return material_table::scale(material, total_score);
+}
 
-    return total_score;
+/* Rank 0 owns the clock and the node count. The first time it finds its hard limit passed or the node limit
+ * reached, it broadcasts the stop with MPI_Ibcast on stop_comm, and the other ranks, which posted the receive when
+ * the iteration began, test for it every POLL_INTERVAL nodes without blocking. A rank the stop has reached returns
+ * at once from every node it searches alone; the nodes it shares with other ranks still run their collectives, so
+ * all of them unwind together into the reduction at the root.
+ */
+bool NaiveMPIEngine::stop_requested(bool shared) {
+    if (time_limit_reached) {
+        return true;
+    }
+    if (world_rank == 0) {
+        // Rank 0 only counts its own nodes of the iteration under way, and takes every rank to have searched as
+        // many, as the ranks share the moves out evenly. The count costs a comparison, so unlike the clock it is
+        // checked at every node.
+        bool out_of_nodes = node_limit > 0
+                            && nodes_searched + stats[search_stats::EVALUATED] * world_size >= node_limit;
+        if (out_of_nodes || timer.poll(shared ? 1 : time_manager::POLL_INTERVAL)) {
+            stop_flag = 1;
+            stop_posted = true;
+            time_limit_reached = true;
+            MPI_Ibcast(&stop_flag, 1, MPI_INT, 0, stop_comm, &stop_request);
+        }
+    } else if (shared || ++stop_polls % time_manager::POLL_INTERVAL == 0) {
+        int arrived = 0;
+        MPI_Test(&stop_request, &arrived, MPI_STATUS_IGNORE);
+        if (arrived && stop_flag) {
+            time_limit_reached = true;
+        }
+    }
+    return time_limit_reached;
 }
 
-int debug_node_count = 0;
+/* A rank that is done with its share of a node waits here for the others. Rank 0 owns the clock, so it must not
+ * block: it waits on a non-blocking reduction and keeps checking the clock, otherwise a rank 0 that finished early
+ * could not stop the ranks still searching.
+ */
+std::pair<NaiveMPIEngine::Score, thc::Move>
+NaiveMPIEngine::reduce_best(const std::pair<Score, thc::Move>& ans_pair, MPI_Op op, MPI_Comm comm) {
+    std::pair<Score, thc::Move> best_ans;
+    MPI_Request request;
+    MPI_Iallreduce(&ans_pair, &best_ans, 1, MPI_FLOAT_INT, op, comm, &request);
+    if (world_rank != 0) {
+        MPI_Wait(&request, MPI_STATUS_IGNORE);
+        return best_ans;
+    }
+
+    int done = 0;
+    MPI_Test(&request, &done, MPI_STATUS_IGNORE);
+    while (!done) {
+        stop_requested(true);
+        std::this_thread::yield();
+        MPI_Test(&request, &done, MPI_STATUS_IGNORE);
+    }
+    return best_ans;
+}
 
-thc::Move NaiveMPIEngine::solve(thc::ChessRules& cr, bool is_white_player) {
+search_limits::SearchResult NaiveMPIEngine::solve(thc::ChessRules& cr, bool is_white_player,
+                                                  const search_limits::SearchLimits& limits) {
     this->time_limit_reached = false;
 
-    int pid;
+    int pid, nproc;
 
     MPI_Comm_rank(MPI_COMM_WORLD, &pid);
+    MPI_Comm_size(MPI_COMM_WORLD, &nproc);
     this->start_time = std::chrono::steady_clock::now();
-
-    thc::Move best_move_so_far;
+    this->timer.start(limits, cr.white, DEFAULT_TIME_LIMIT_SECONDS);
+    this->node_limit = limits.nodes;
+    this->world_rank = pid;
+    this->world_size = nproc;
+    if (stop_comm == MPI_COMM_NULL) {
+        MPI_Comm_dup(MPI_COMM_WORLD, &stop_comm);
+    }
+    this->nodes_searched = 0;
+    int depth_limit = limits.max_depth(DEFAULT_DEPTH);
+    profile::begin();
+    perf_counters::attach(0);
+    std::vector<perf_counters::Values> search_counters = perf_counters::read();
+    uint64_t rank_nodes_searched = 0;
+
+    search_limits::SearchResult result;
     bool move_found = false;
 
-    for (int current_depth = 1; current_depth <= MAX_DEPTH; ++current_depth) {
-        debug_node_count = 0;
-        if (time_limit_reached) {
-            break; 
+    for (int current_depth = 1; current_depth <= depth_limit; ++current_depth) {
+        stats.clear();
+        // The soft time limit and the node limit are checked between iterations, the hard limit and the node limit
+        // inside them (see stop_requested). Rank 0 decides, so that every rank starts the same iterations.
+        int out_of_limits = pid == 0 && (!timer.time_for_iteration() || (node_limit > 0 && nodes_searched >= node_limit));
+        MPI_Bcast(&out_of_limits, 1, MPI_INT, 0, MPI_COMM_WORLD);
+        if (out_of_limits) {
+            break;
+        }
+
+        // Rank 0 broadcasts the stop flag of the iteration when its hard limit passes, or clear once the search is
+        // over. The other ranks post the receive now and poll it as they search.
+        stop_flag = 0;
+        stop_posted = false;
+        if (pid != 0) {
+            MPI_Ibcast(&stop_flag, 1, MPI_INT, 0, stop_comm, &stop_request);
         }
 
         // thc::Move current_best_move;
+        std::vector<perf_counters::Values> iteration_counters = perf_counters::read();
         auto [current_score, current_best_move] = solve_naive_mpi_engine(
             cr,
             is_white_player,
@@ -471,11 +364,43 @@ thc::Move NaiveMPIEngine::solve(thc::ChessRules& cr, bool is_white_player) {
             MPI_COMM_WORLD
         );
 
+        // Every rank learns whether the iteration was stopped, and keeps the last complete one if it was
+        if (pid == 0 && !stop_posted) {
+            MPI_Ibcast(&stop_flag, 1, MPI_INT, 0, stop_comm, &stop_request);
+        }
+        MPI_Wait(&stop_request, MPI_STATUS_IGNORE);
+        time_limit_reached = stop_flag != 0;
+
         if (time_limit_reached) {
             break; 
         }
 
-        best_move_so_far = current_best_move;
+        perf_counters::Values hardware = perf_counters::total(perf_counters::difference(perf_counters::read(), iteration_counters));
+        // Every rank counts what it searched: add their counts up
+        search_stats::Values totals;
+        MPI_Allreduce(stats.values().data(), totals.data(), search_stats::COUNTER_COUNT, MPI_UINT64_T, MPI_SUM,
+                      MPI_COMM_WORLD);
+        search_stats::Counters iteration(totals);
+        nodes_searched += iteration[search_stats::EVALUATED];
+        rank_nodes_searched += stats[search_stats::EVALUATED];
+
+        // Rank 0 also learns the deepest ply any rank reached, and how the nodes were shared out
+        int seldepth = stats.seldepth();
+        MPI_Reduce(pid == 0 ? MPI_IN_PLACE : &seldepth, &seldepth, 1, MPI_INT, MPI_MAX, 0, MPI_COMM_WORLD);
+        iteration.reach(seldepth);
+        uint64_t rank_nodes = stats[search_stats::EVALUATED];
+        std::vector<uint64_t> nodes_per_rank(pid == 0 ? nproc : 0);
+        MPI_Gather(&rank_nodes, 1, MPI_UINT64_T, nodes_per_rank.data(), 1, MPI_UINT64_T, 0, MPI_COMM_WORLD);
+        if (perf_counters::enabled()) {
+            MPI_Reduce(pid == 0 ? MPI_IN_PLACE : hardware.data(), hardware.data(), perf_counters::EVENT_COUNT,
+                       MPI_UINT64_T, MPI_SUM, 0, MPI_COMM_WORLD);
+        }
+
+        result.best_move = current_best_move;
+        result.score = current_score;
+        result.depth = current_depth;
+        timer.iteration_complete(current_best_move);
+        result.pv.assign(1, current_best_move);
         move_found = true;
 
         if (pid != 0) continue;
@@ -486,24 +411,75 @@ thc::Move NaiveMPIEngine::solve(thc::ChessRules& cr, bool is_white_player) {
         std::cout << "Depth: " <<  current_depth 
         << ", Score: " << (current_score / 100.0f) 
         << ", Time: " << elapsed_seconds.count() << "s" 
-        << ", Nodes Evaluated = " << debug_node_count 
-        << ", knps: " << (debug_node_count/1000.0) / elapsed_seconds.count() 
+        << ", Nodes Evaluated = " << iteration[search_stats::EVALUATED] 
+        << ", knps: " << (iteration[search_stats::EVALUATED]/1000.0) / elapsed_seconds.count() 
         << std::endl;
+        if (perf_counters::enabled()) {
+            std::cout << "Hardware: " << perf_counters::describe(hardware, iteration[search_stats::EVALUATED]) << std::endl;
+        }
+
+        if (telemetry::enabled()) {
+            telemetry::Iteration record;
+            record.engine = "naive-mpi";
+            record.depth = current_depth;
+            record.score = current_score;
+            record.pv = result.pv;
+            record.seconds = elapsed_seconds.count();
+            record.branching_factor = timer.branching_factor();
+            record.counters = iteration;
+            record.workers = nodes_per_rank;
+            record.hardware = hardware;
+            telemetry::iteration(record);
+        }
+    }
+
+#ifdef SEARCH_PROFILE
+    // Every rank timed its own share of the search: add the zones up on rank 0, which reports them
+    profile::Totals rank_profile = profile::collect();
+    profile::Totals all_ranks = rank_profile;
+    MPI_Reduce(rank_profile.cycles, all_ranks.cycles, profile::ZONE_COUNT, MPI_UINT64_T, MPI_SUM, 0, MPI_COMM_WORLD);
+    MPI_Reduce(rank_profile.calls, all_ranks.calls, profile::ZONE_COUNT, MPI_UINT64_T, MPI_SUM, 0, MPI_COMM_WORLD);
+    if (pid == 0) {
+        profile::report(all_ranks);
+    }
+#endif
+
+    // Rank 0 learns how the nodes of the whole search were shared out
+    std::vector<uint64_t> nodes_per_rank(pid == 0 ? nproc : 0);
+    MPI_Gather(&rank_nodes_searched, 1, MPI_UINT64_T, nodes_per_rank.data(), 1, MPI_UINT64_T, 0, MPI_COMM_WORLD);
+    result.workers = nodes_per_rank;
+
+    if (perf_counters::enabled()) {
+        // Each rank counted its own process: rank 0 reports them all
+        perf_counters::Values rank_hardware = perf_counters::total(perf_counters::difference(perf_counters::read(), search_counters));
+        std::vector<perf_counters::Values> hardware_per_rank(pid == 0 ? nproc : 0);
+        MPI_Gather(rank_hardware.data(), perf_counters::EVENT_COUNT, MPI_UINT64_T, hardware_per_rank.data(),
+                   perf_counters::EVENT_COUNT, MPI_UINT64_T, 0, MPI_COMM_WORLD);
+        if (pid == 0) {
+            std::cout << "Hardware, whole search: " << perf_counters::describe(perf_counters::total(hardware_per_rank), nodes_searched) << std::endl;
+            for (int rank = 0; rank < nproc; rank++) {
+                std::cout << "  Rank " << rank << ": " << perf_counters::describe(hardware_per_rank[rank], nodes_per_rank[rank]) << std::endl;
+            }
+        }
     }
 
-    if (move_found) {
-        return best_move_so_far;
-    } else {
+    if (!move_found) {
         // If no move was found (unlikely), generate a random legal move
         std::vector<thc::Move> legal_moves;
         cr.GenLegalMoveList(legal_moves);
         if (!legal_moves.empty()) {
-            return legal_moves[0];
+            result.best_move = legal_moves[0];
         } else {
             // No legal moves, return a default move
-            return thc::Move();
+            result.best_move = thc::Move();
         }
+        result.pv.assign(1, result.best_move);
     }
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::steady_clock::now() - start_time;
+    result.nodes = nodes_searched;
+    result.time = elapsed_seconds.count();
+    return result;
 }
 
 std::pair<NaiveMPIEngine::Score, thc::Move>
@@ -512,13 +488,25 @@ NaiveMPIEngine::solve_naive_mpi_engine(
     bool is_white_player,
     int depth,
     int max_depth,
-    MPI_Comm comm
+    MPI_Comm comm,
+    const eval_kernel::BoardSummary* leaf_board
 ) {
     int pid, nproc;
 
     MPI_Comm_rank(comm, &pid);
     MPI_Comm_size(comm, &nproc);
 
+    // Once stopped, a node this rank searches alone returns at once (its score is thrown away with the iteration)
+    if (stop_requested(nproc > 1) && nproc == 1) {
+        return {0.0f, thc::Move()};
+    }
+
+    // A node shared by several ranks is counted once, by the first of them
+    stats.reach(depth);
+    if (pid == 0) {
+        stats.add(search_stats::NODES);
+    }
+
     {
         thc::Move null_move;
 
@@ -531,19 +519,19 @@ NaiveMPIEngine::solve_naive_mpi_engine(
         thc::TERMINAL terminal;
         if (cr.Evaluate(terminal)) {
             if (terminal == thc::TERMINAL_WCHECKMATE) {
-                debug_node_count++;
+                stats.add(search_stats::EVALUATED);
                 return {-INF_SCORE + depth, null_move}; // White is checkmated
             } else if (terminal == thc::TERMINAL_BCHECKMATE) {
-                debug_node_count++;
+                stats.add(search_stats::EVALUATED);
                 return {INF_SCORE - depth, null_move}; // Black is checkmated
             } else if (terminal == thc::TERMINAL_WSTALEMATE || terminal == thc::TERMINAL_BSTALEMATE) {
-                debug_node_count++;
+                stats.add(search_stats::EVALUATED);
                 return {0.0f, null_move}; // Stalemate is a draw
             }
         }
         if (depth == max_depth) {
-            debug_node_count++;
-            return {static_eval(cr), null_move};
+            stats.add(search_stats::EVALUATED);
+            return {leaf_board ? static_eval(cr, *leaf_board) : static_eval(cr), null_move};
         }
     }
 
@@ -558,11 +546,26 @@ NaiveMPIEngine::solve_naive_mpi_engine(
         // only contains me in the subset
         bool found = false;
 
-        for (int i=pid;i<legal_moves.size();i+=nproc) {
+        // A ply above the leaves every child is a leaf, and all of my share of them are searched, so their
+        // summaries are made together from this node's, a batch at a time (see eval-kernel.h)
+        std::vector<thc::Move> my_moves;
+        std::vector<eval_kernel::BoardSummary> leaves;
+        if (depth == max_depth - 1) {
+            for (size_t i = pid; i < legal_moves.size(); i += nproc) {
+                my_moves.push_back(legal_moves[i]);
+            }
+            eval_kernel::BoardSummary board;
+            eval_kernel::summarise(cr.squares, board);
+            leaves.resize(my_moves.size());
+            eval_kernel::summarise_children(cr.squares, board, my_moves.data(), my_moves.size(), leaves.data());
+        }
+
+        for (int i=pid, j=0;i<legal_moves.size();i+=nproc, j++) {
             thc::ChessRules cr_copy = cr;
             cr_copy.PushMove(legal_moves[i]);
 
-            auto curr_ans = solve_naive_mpi_engine(cr_copy, !is_white_player, depth+1, max_depth, my_comm);
+            auto curr_ans = solve_naive_mpi_engine(cr_copy, !is_white_player, depth+1, max_depth, my_comm,
+                                                   leaves.empty() ? nullptr : &leaves[j]);
             if (!found) {
                 ans_pair = curr_ans;
                 found = true;
@@ -599,10 +602,10 @@ NaiveMPIEngine::solve_naive_mpi_engine(
     std::pair<NaiveMPIEngine::Score, thc::Move> best_ans;
 
     if (is_white_player) {
-        MPI_Allreduce(&ans_pair, &best_ans, 1, MPI_FLOAT_INT, MPI_MINLOC, comm);
+        best_ans = reduce_best(ans_pair, MPI_MINLOC, comm);
     }
     else {
-        MPI_Allreduce(&ans_pair, &best_ans, 1, MPI_FLOAT_INT, MPI_MAXLOC, comm);
+        best_ans = reduce_best(ans_pair, MPI_MAXLOC, comm);
     }
 
     return best_ans;
@@ -0,0 +1,177 @@
+/*
+ *  endgame
+ *
+ *  See endgame.h. The edge, corner and king distance terms follow the well known Stockfish ones. Every evaluator
+ *  works with the strong side as white (squares of a black strong side are mirrored top to bottom) and negates
+ *  its result at the end if the strong side is black.
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include "endgame.h"
+#include "kpk.h"
+
+namespace endgame {
+
+namespace {
+
+// Squares as in thc: a8 = 0, h1 = 63
+int file_of(int sq) { return sq % 8; }
+int rank_of(int sq) { return 7 - sq / 8; }     // 0 for the first rank
+
+int distance(int a, int b) {
+    return std::max(std::abs(file_of(a) - file_of(b)), std::abs(rank_of(a) - rank_of(b)));
+}
+
+int edge_distance(int x) {
+    return std::min(x, 7 - x);
+}
+
+// Bonus for the defending king being near the edge, highest in the corners
+int push_to_edge(int sq) {
+    int fd = edge_distance(file_of(sq));
+    int rd = edge_distance(rank_of(sq));
+    return 90 - (7 * fd * fd / 2 + 7 * rd * rd / 2);
+}
+
+// Bonus for the defending king being near a1 or h8 (0 on the a8-h1 diagonal, 7 in those corners)
+int push_to_corner(int sq) {
+    return std::abs(7 - rank_of(sq) - file_of(sq));
+}
+
+// Bonus for the kings being close together
+int push_close(int a, int b) {
+    return 140 - 20 * distance(a, b);
+}
+
+// Squares of the rectangle a rook (or the queen, moving like one) fences the defending king into with its file
+// and rank. The king cannot cross those lines, so shrinking the rectangle is progress a shallow search can see.
+int box_area(int rook, int king) {
+    int rf = file_of(rook), rr = rank_of(rook), kf = file_of(king), kr = rank_of(king);
+    int width = kf < rf ? rf : kf > rf ? 7 - rf : 8;
+    int height = kr < rr ? rr : kr > rr ? 7 - rr : 8;
+    return width * height;
+}
+
+int only_square(const eval_kernel::BoardSummary& board, int code) {
+    return __builtin_ctzll(board.bitboards[code]);
+}
+
+// Piece code of the same piece for the strong or the weak side
+int code(bool white, int white_code) {
+    return white ? white_code : white_code - eval_kernel::WP + eval_kernel::BP;
+}
+
+// A square seen with the strong side as white
+int relative(bool strong_white, int sq) {
+    return strong_white ? sq : sq ^ 56;
+}
+
+// How far the king is from the nearest key square of a pawn (the three squares two ranks ahead of it). With the
+// king on one, a pawn off the rook files queens whoever is to move, so a won KPK is converted by heading there.
+int key_square_distance(int king, int pawn) {
+    int files = std::max(std::abs(file_of(king) - file_of(pawn)) - 1, 0);
+    int ranks = std::abs(rank_of(king) - std::min(rank_of(pawn) + 2, 7));
+    return std::max(files, ranks);
+}
+
+// King and pawn vs king: exact from the bitbase. A win is worth a known win plus progress: the pawn's rank, the
+// strong king near the key squares and the weak king away from the queening square. A pawn push outweighs the
+// king falling a step behind the key squares that move with it, so the search has a score to climb instead of
+// shuffling, and the total stays below what the position is worth once the pawn has become a queen or rook.
+int evaluate_kpk(const eval_kernel::BoardSummary& board, bool strong_white, bool white_to_move) {
+    int strong_king = eval_kernel::king_square(board, strong_white);
+    int weak_king = eval_kernel::king_square(board, !strong_white);
+    int pawn = only_square(board, code(strong_white, eval_kernel::WP));
+
+    if (!kpk::probe(strong_white, white_to_move == strong_white, strong_king, pawn, weak_king)) {
+        return 0;
+    }
+
+    pawn = relative(strong_white, pawn);
+    int queening = file_of(pawn);       // the eighth rank square of the pawn's file
+    int result = KNOWN_WIN + eval_kernel::PAWN_VALUE + (rank_of(pawn) - 1) * 40
+               - 10 * key_square_distance(relative(strong_white, strong_king), pawn)
+               + 5 * distance(relative(strong_white, weak_king), queening);
+    return strong_white ? result : -result;
+}
+
+// King and queen or king and rook vs king: drive the lone king to the edge and follow it with the king
+int evaluate_kxk(const eval_kernel::BoardSummary& board, bool strong_white, bool white_to_move) {
+    int strong_king = eval_kernel::king_square(board, strong_white);
+    int weak_king = eval_kernel::king_square(board, !strong_white);
+
+    int piece = only_square(board, code(strong_white, eval_kernel::piece_count(board, code(strong_white, eval_kernel::WQ))
+                                                      ? eval_kernel::WQ : eval_kernel::WR));
+
+    int result = KNOWN_WIN + eval_kernel::material(board, strong_white)
+               + push_to_edge(weak_king) + push_close(strong_king, weak_king) + 4 * (64 - box_area(piece, weak_king));
+    return strong_white ? result : -result;
+}
+
+// King, bishop and knight vs king: mate is only possible in a corner the bishop covers, so drive the king there
+int evaluate_kbnk(const eval_kernel::BoardSummary& board, bool strong_white, bool white_to_move) {
+    int strong_king = eval_kernel::king_square(board, strong_white);
+    int weak_king = eval_kernel::king_square(board, !strong_white);
+    int bishop = only_square(board, code(strong_white, eval_kernel::WB));
+
+    // push_to_corner favours a1/h8, which are dark; for a light-squared bishop mirror the board left to right
+    bool dark_bishop = (file_of(bishop) + rank_of(bishop)) % 2 == 0;
+    int corner_king = dark_bishop ? weak_king : weak_king ^ 7;
+
+    int result = KNOWN_WIN + eval_kernel::BISHOP_VALUE + eval_kernel::KNIGHT_VALUE
+               + push_close(strong_king, weak_king) + 420 * push_to_corner(corner_king);
+    return strong_white ? result : -result;
+}
+
+// King and rook vs king and pawn: usually a win, unless the pawn is far advanced and its king is there to support
+// it while the strong king is out of play
+int evaluate_krkp(const eval_kernel::BoardSummary& board, bool strong_white, bool white_to_move) {
+    int strong_king = relative(strong_white, eval_kernel::king_square(board, strong_white));
+    int weak_king = relative(strong_white, eval_kernel::king_square(board, !strong_white));
+    int rook = relative(strong_white, only_square(board, code(strong_white, eval_kernel::WR)));
+    int pawn = relative(strong_white, only_square(board, code(!strong_white, eval_kernel::WP)));
+    bool strong_to_move = white_to_move == strong_white;
+
+    // With the strong side as white the pawn runs towards the first rank
+    int promotion = 56 + file_of(pawn);
+    int in_front = pawn + 8;
+
+    int result;
+    if (file_of(strong_king) == file_of(pawn) && rank_of(strong_king) < rank_of(pawn)) {
+        // The strong king blocks the pawn
+        result = eval_kernel::ROOK_VALUE - 4 * distance(strong_king, pawn);
+    } else if (distance(weak_king, pawn) >= 3 + !strong_to_move && distance(weak_king, rook) >= 3) {
+        // The pawn is on its own and the rook is safe
+        result = eval_kernel::ROOK_VALUE - 4 * distance(strong_king, pawn);
+    } else if (rank_of(weak_king) <= 2 && distance(weak_king, pawn) == 1 && rank_of(strong_king) >= 3
+               && distance(strong_king, pawn) > 2 + strong_to_move) {
+        // Advanced pawn escorted by its king, the strong king too far away: drawish
+        result = 40 - 4 * distance(strong_king, pawn);
+    } else {
+        // Race between the kings for the square in front of the pawn
+        result = 100 - 4 * (distance(strong_king, in_front) - distance(weak_king, in_front)
+                            - distance(pawn, promotion));
+    }
+    return strong_white ? result : -result;
+}
+
+// Indexed by material_table::EndgameType
+const Evaluator REGISTRY[] = {
+    nullptr,            // ENDGAME_NONE
+    evaluate_kpk,       // ENDGAME_KPK
+    evaluate_kxk,       // ENDGAME_KQK
+    evaluate_kxk,       // ENDGAME_KRK
+    evaluate_kbnk,      // ENDGAME_KBNK
+    evaluate_krkp,      // ENDGAME_KRKP
+};
+static_assert(sizeof(REGISTRY) / sizeof(REGISTRY[0]) == material_table::ENDGAME_KRKP + 1,
+              "one evaluator per endgame type");
+
+} // namespace
+
+Evaluator evaluator(material_table::EndgameType type) {
+    return REGISTRY[type];
+}
+
+} // namespace endgame
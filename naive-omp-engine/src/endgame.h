@@ -0,0 +1,36 @@
+#ifndef ENDGAME_H
+#define ENDGAME_H
+
+/*
+ *  endgame
+ *
+ *  Evaluation functions for the endings material_table recognises by signature (see EndgameType). The general
+ *  terms of static_eval know nothing about how these are converted, so on their own the engine drifts around
+ *  won positions for many moves. Instead each evaluator scores what actually makes progress: the defending king
+ *  pushed to the edge (in KBNK, to a corner of the bishop's colour) and the attacking king brought close to it.
+ *
+ *  Evaluators are looked up in a registry indexed by EndgameType, so static_eval dispatches with one probe of
+ *  the material table and no board scan. Scores are white minus black, like static_eval.
+ */
+
+#include "eval-kernel.h"
+#include "material-table.h"
+
+namespace endgame {
+
+// Score of an ending that is won by force, before the progress terms: above any material balance, below mates
+constexpr int KNOWN_WIN = 10000;
+
+using Evaluator = int (*)(const eval_kernel::BoardSummary& board, bool strong_white, bool white_to_move);
+
+// The evaluator registered for an endgame type, nullptr for ENDGAME_NONE
+Evaluator evaluator(material_table::EndgameType type);
+
+inline int evaluate(material_table::EndgameType type, const eval_kernel::BoardSummary& board, bool strong_white,
+                    bool white_to_move) {
+    return evaluator(type)(board, strong_white, white_to_move);
+}
+
+} // namespace endgame
+
+#endif // ENDGAME_H
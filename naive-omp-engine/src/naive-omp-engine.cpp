@@ -17,73 +17,6 @@
 #define AB_BREAK 1
 #define TIME_LIMIT_EXCEEDED 2
 
-// Piece-square tables for evaluation (a.k.a. heat maps)
-const int pawn_table[64] = {
-     0,  0,  0,  0,  0,  0,  0,  0,
-    50, 50, 50, 50, 50, 50, 50, 50,
-    10, 10, 20, 30, 30, 20, 10, 10,
-     5,  5, 10, 25, 25, 10,  5,  5,
-     0,  0,  0, 20, 20,  0,  0,  0,
-     5, -5,-10,  0,  0,-10, -5,  5,
-     5, 10, 10,-20,-20, 10, 10,  5,
-     0,  0,  0,  0,  0,  0,  0,  0
-};
-
-const int knight_table[64] = {
-    -50,-40,-30,-30,-30,-30,-40,-50,
-    -40,-20,  0,  0,  0,  0,-20,-40,
-    -30,  0, 10, 15, 15, 10,  0,-30,
-    -30,  5, 15, 20, 20, 15,  5,-30,
-    -30,  0, 15, 20, 20, 15,  0,-30,
-    -30,  5, 10, 15, 15, 10,  5,-30,
-    -40,-20,  0,  5,  5,  0,-20,-40,
-    -50,-40,-30,-30,-30,-30,-40,-50
-};
-
-const int bishop_table[64] = {
-    -20,-10,-10,-10,-10,-10,-10,-20,
-    -10,  0,  0,  0,  0,  0,  0,-10,
-    -10,  0,  5, 10, 10,  5,  0,-10,
-    -10,  5,  5, 10, 10,  5,  5,-10,
-    -10,  0, 10, 10, 10, 10,  0,-10,
-    -10, 10, 10, 10, 10, 10, 10,-10,
-    -10,  5,  0,  0,  0,  0,  5,-10,
-    -20,-10,-10,-10,-10,-10,-10,-20
-};
-
-const int rook_table[64] = {
-     0,  0,  0,  0,  0,  0,  0,  0,
-     5, 10, 10, 10, 10, 10, 10,  5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-     0,  0,  0,  5,  5,  0,  0,  0
-};
-
-const int queen_table[64] = {
-    -20,-10,-10, -5, -5,-10,-10,-20,
-    -10,  0,  0,  0,  0,  0,  0,-10,
-    -10,  0,  5,  5,  5,  5,  0,-10,
-     -5,  0,  5,  5,  5,  5,  0, -5,
-      0,  0,  5,  5,  5,  5,  0, -5,
-    -10,  5,  5,  5,  5,  5,  0,-10,
-    -10,  0,  5,  0,  0,  0,  0,-10,
-    -20,-10,-10, -5, -5,-10,-10,-20
-};
-
-const int king_table[64] = {
-    -30,-40,-40,-50,-50,-40,-40,-30,
-    -30,-40,-40,-50,-50,-40,-40,-30,
-    -30,-40,-40,-50,-50,-40,-40,-30,
-    -30,-40,-40,-50,-50,-40,-40,-30,
-    -20,-30,-30,-40,-40,-30,-30,-20,
-    -10,-20,-20,-20,-20,-20,-20,-10,
-     20, 20,  0,  0,  0,  0, 20, 20,
-     20, 30, 10,  0,  0, 10, 30, 20
-};
-
 struct MinScoreData {
 float score = 1000.0f;
 int index = -1;
@@ -96,15 +29,16 @@ int index = -1;
 float NaiveOMPEngine::score_move(const thc::Move& move, thc::ChessRules& cr) {
     float score = 0.0f;
 
- 
+    // Check if the move is a capture
     if (move.capture != ' ') {
+        // Assign a higher score for capturing higher-value pieces
         switch (tolower(move.capture)) {
             case 'p': score += 1.0f; break;
             case 'n': score += 3.0f; break;
             case 'b': score += 3.0f; break;
             case 'r': score += 5.0f; break;
             case 'q': score += 9.0f; break;
-            case 'k': score += 1000.0f; break; 
+            case 'k': score += 1000.0f; break; // King capture (shouldn't happen)
         }
     }
 
@@ -116,36 +50,13 @@ float NaiveOMPEngine::score_move(const thc::Move& move, thc::ChessRules& cr) {
     // Positional gain
     int from_index = static_cast<int>(move.src);
     int to_index = static_cast<int>(move.dst);
-    char piece = cr.squares[from_index];
-
-    if (isupper(piece)) { // White pieces
-        switch (piece) {
-            case 'P': score += (pawn_table[to_index] - pawn_table[from_index]) / 100.0f; break;
-            case 'N': score += (knight_table[to_index] - knight_table[from_index]) / 100.0f; break;
-            case 'B': score += (bishop_table[to_index] - bishop_table[from_index]) / 100.0f; break;
-            case 'R': score += (rook_table[to_index] - rook_table[from_index]) / 100.0f; break;
-            case 'Q': score += (queen_table[to_index] - queen_table[from_index]) / 100.0f; break;
-            case 'K': score += (king_table[to_index] - king_table[from_index]) / 100.0f; break;
-        }
-    } else { // Black pieces
-        int flipped_from_index = 63 - from_index;
-        int flipped_to_index = 63 - to_index;
-
-        switch (piece) {
-            case 'p': score += (pawn_table[flipped_to_index] - pawn_table[flipped_from_index]) / 100.0f; break;
-            case 'n': score += (knight_table[flipped_to_index] - knight_table[flipped_from_index]) / 100.0f; break;
-            case 'b': score += (bishop_table[flipped_to_index] - bishop_table[flipped_from_index]) / 100.0f; break;
-            case 'r': score += (rook_table[flipped_to_index] - rook_table[flipped_from_index]) / 100.0f; break;
-            case 'q': score += (queen_table[flipped_to_index] - queen_table[flipped_from_index]) / 100.0f; break;
-            case 'k': score += (king_table[flipped_to_index] - king_table[flipped_from_index]) / 100.0f; break;
-        }
-    }
+    score += eval_kernel::psqt_delta(cr.squares[from_index], from_index, to_index) / 100.0f;
 
     return score;
 }
 
 // Add a mobility bonus for the pieces (not sure if this helps).
-int NaiveOMPEngine::evaluate_mobility(thc::ChessRules& cr, bool is_white, const std::vector<int>& piece_indices) {
+int NaiveOMPEngine::evaluate_mobility(thc::ChessRules& cr, bool is_white) {
     int mobility_score = 0;
     thc::ChessRules cr_copy = cr;
     std::vector<thc::Move> moves;
@@ -168,13 +79,13 @@ int NaiveOMPEngine::evaluate_mobility(thc::ChessRules& cr, bool is_white, const
     return mobility_score;
 }
 
-int NaiveOMPEngine::evaluate_pawn_structure(const std::vector<int>& pawn_files, bool is_white) {
+int NaiveOMPEngine::evaluate_pawn_structure(uint64_t pawns, bool is_white) {
     int score = 0;
 
     // Count pawns on each file
     int file_counts[8] = {0};
-    for (int file : pawn_files) {
-        file_counts[file]++;
+    for (int i = 0; i < 8; ++i) {
+        file_counts[i] = __builtin_popcountll(pawns & (0x0101010101010101ULL << i));
     }
 
     // Evaluate pawn structure
@@ -287,144 +198,44 @@ int NaiveOMPEngine::evaluate_king_activity(int own_king_index, int opponent_king
 }
 
 
-const int ENDGAME_MATERIAL_THRESHOLD = 2400; // Adjust based on testing
-
-bool NaiveOMPEngine::is_endgame(int white_material, int black_material) {
-    int total_material = white_material + black_material;
-    return total_material <= ENDGAME_MATERIAL_THRESHOLD; // Define a threshold, e.g., 2400 (two rooks)
+NaiveOMPEngine::Score NaiveOMPEngine::static_eval(thc::ChessRules& cr) {
+    // Evaluate material and positional bonuses for the whole board at once (see eval-kernel.h)
+    eval_kernel::BoardSummary board;
+    eval_kernel::summarise(cr.squares, board);
+    return static_eval(cr, board);
 }
 
-NaiveOMPEngine::Score NaiveOMPEngine::static_eval(thc::ChessRules& cr) {
-    Score total_score = 0.0f;
+NaiveOMPEngine::Score NaiveOMPEngine::static_eval(thc::ChessRules& cr, const eval_kernel::BoardSummary& board) {
+    PROFILE_ZONE(profile::STATIC_EVAL);
+    Score total_score = board.material_pst;
 
-    // Material counts
-    int white_material = 0;
-    int black_material = 0;
+    // Game phase, scaling and endgame type for this material (see material-table.h)
+    material_table::Entry material = material_table::probe(cr.material_key);
 
-    // Piece counts for bishop pair evaluation
-    int white_bishops = 0;
-    int black_bishops = 0;
+    // Specialised endgames (KPK, KQK, KRK, KBNK, KRKP) have an evaluator of their own (see endgame.h)
+    if (material.endgame != material_table::ENDGAME_NONE) {
+        return endgame::evaluate(material.endgame, board, material.strong_white, cr.WhiteToPlay());
+    }
 
     // King positions
-    int white_king_index = -1;
-    int black_king_index = -1;
-
-    // Variables for pawn structure
-    std::vector<int> white_pawn_files;
-    std::vector<int> black_pawn_files;
-
-    // Piece positions for mobility evaluation
-    std::vector<int> white_piece_indices;
-    std::vector<int> black_piece_indices;
-
-    // Evaluate material and positional bonuses
-    for (int i = 0; i < 64; i++) {
-        char piece = cr.squares[i];
-        if (piece == ' ')
-            continue;
-
-        int index = i;
-        int flipped_index = 63 - i; // Flips the board for Black
-        int piece_value = 0;
-        float positional_bonus = 0.0f;
-
-        bool is_white = isupper(piece);
-        char lower_piece = tolower(piece);
-
-        switch (lower_piece) {
-            case 'p':
-                piece_value = 100;
-                positional_bonus = pawn_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_pawn_files.push_back(index % 8);
-                } else {
-                    black_material += piece_value;
-                    black_pawn_files.push_back(index % 8);
-                }
-                break;
-            case 'n':
-                piece_value = 320;
-                positional_bonus = knight_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_piece_indices.push_back(index);
-                } else {
-                    black_material += piece_value;
-                    black_piece_indices.push_back(index);
-                }
-                break;
-            case 'b':
-                piece_value = 330;
-                positional_bonus = bishop_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_bishops++;
-                    white_piece_indices.push_back(index);
-                } else {
-                    black_material += piece_value;
-                    black_bishops++;
-                    black_piece_indices.push_back(index);
-                }
-                break;
-            case 'r':
-                piece_value = 500;
-                positional_bonus = rook_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_piece_indices.push_back(index);
-                } else {
-                    black_material += piece_value;
-                    black_piece_indices.push_back(index);
-                }
-                break;
-            case 'q':
-                piece_value = 900;
-                positional_bonus = queen_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_piece_indices.push_back(index);
-                } else {
-                    black_material += piece_value;
-                    black_piece_indices.push_back(index);
-                }
-                break;
-            case 'k':
-                piece_value = 20000; // High value for the King
-                positional_bonus = king_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_king_index = index;
-                } else {
-                    black_king_index = index;
-                }
-                break;
-            default:
-                break;
-        }
-
-        Score square_score = piece_value + positional_bonus;
-        if (is_white) {
-            total_score += square_score;
-        } else {
-            total_score -= square_score;
-        }
-    }
+    int white_king_index = eval_kernel::king_square(board, true);
+    int black_king_index = eval_kernel::king_square(board, false);
 
     // Bishop pair bonus
-    if (white_bishops >= 2) total_score += 50;
-    if (black_bishops >= 2) total_score -= 50;
+    if (eval_kernel::piece_count(board, eval_kernel::WB) >= 2) total_score += 50;
+    if (eval_kernel::piece_count(board, eval_kernel::BB) >= 2) total_score -= 50;
 
     // Mobility evaluation
-    total_score += evaluate_mobility(cr, true, white_piece_indices);
-    total_score -= evaluate_mobility(cr, false, black_piece_indices);
+    total_score += evaluate_mobility(cr, true);
+    total_score -= evaluate_mobility(cr, false);
 
     // Pawn structure evaluation
-    total_score += evaluate_pawn_structure(white_pawn_files, true);
-    total_score -= evaluate_pawn_structure(black_pawn_files, false);
+    total_score += evaluate_pawn_structure(board.bitboards[eval_kernel::WP], true);
+    total_score -= evaluate_pawn_structure(board.bitboards[eval_kernel::BP], false);
 
     // King safety evaluation
 
-    bool endgame = is_endgame(white_material, black_material);
+    bool endgame = material.flags & material_table::ENDGAME;
 
     total_score += evaluate_king_safety(cr, white_king_index, true, endgame);
     total_score -= evaluate_king_safety(cr, black_king_index, false, endgame);
@@ -437,28 +248,52 @@ NaiveOMPEngine::Score NaiveOMPEngine::static_eval(thc::ChessRules& cr) {
         total_score -= evaluate_king_activity(black_king_index, white_king_index, false);
     }
 
-
-    return total_score;
+    // Pull the score towards a draw when the side ahead lacks the material to win
+    return material_table::scale(material, total_score);
 }
 
-// int debug_node_count = 0;
-
-std::atomic<int> debug_node_count(0);
+/* Below the root the parallel loops are nested and run on the thread that entered them, so a whole subtree is
+ * searched by the thread the root handed its move to, and counted in that thread's counters (the root node itself,
+ * outside any parallel region, uses the first set).
+ */
+search_stats::Counters& NaiveOMPEngine::thread_stats() {
+    return stats[omp_get_level() > 0 ? omp_get_ancestor_thread_num(1) : 0];
+}
 
-thc::Move NaiveOMPEngine::solve(thc::ChessRules& cr, bool is_white_player) {
+search_limits::SearchResult NaiveOMPEngine::solve(thc::ChessRules& cr, bool is_white_player,
+                                                  const search_limits::SearchLimits& limits) {
     this->time_limit_reached = false;
     this->start_time = std::chrono::steady_clock::now();
+    this->timer.start(limits, cr.white, DEFAULT_TIME_LIMIT_SECONDS);
+    this->node_limit = limits.nodes;
+    this->nodes_searched = 0;
+    int depth_limit = limits.max_depth(DEFAULT_DEPTH);
+    profile::begin();
+
+    stats.assign(omp_get_max_threads(), search_stats::Counters());
+
+    // Every thread of the pool counts its hardware events in the slot of its thread number
+    if (perf_counters::enabled()) {
+        #pragma omp parallel
+        perf_counters::attach(omp_get_thread_num());
+    }
+    std::vector<perf_counters::Values> search_counters = perf_counters::read();
+    std::vector<uint64_t> thread_nodes(stats.size());
 
-    thc::Move best_move_so_far;
+    search_limits::SearchResult result;
     bool move_found = false;
 
-    for (int current_depth = 1; current_depth <= MAX_DEPTH; ++current_depth) {
-        debug_node_count = 0;
-        if (time_limit_reached) {
+    for (int current_depth = 1; current_depth <= depth_limit; ++current_depth) {
+        for (auto& counters : stats) {
+            counters.clear();
+        }
+        // Past the soft limit an iteration would rarely finish in time
+        if (time_limit_reached || !timer.time_for_iteration()) {
             break; 
         }
 
         thc::Move current_best_move;
+        std::vector<perf_counters::Values> iteration_counters = perf_counters::read();
         Score current_score = solve_naive_omp_engine(
             cr,
             is_white_player,
@@ -469,11 +304,21 @@ thc::Move NaiveOMPEngine::solve(thc::ChessRules& cr, bool is_white_player) {
             INF_SCORE
         );
 
+        perf_counters::Values hardware = perf_counters::total(perf_counters::difference(perf_counters::read(), iteration_counters));
+        search_stats::Counters iteration = search_stats::total(stats);
+        nodes_searched += iteration[search_stats::EVALUATED];
+        for (size_t t = 0; t < stats.size(); t++) {
+            thread_nodes[t] += stats[t][search_stats::EVALUATED];
+        }
         if (time_limit_reached) {
             break; 
         }
 
-        best_move_so_far = current_best_move;
+        result.best_move = current_best_move;
+        result.score = current_score;
+        result.depth = current_depth;
+        timer.iteration_complete(current_best_move);
+        result.pv.assign(1, current_best_move);
         move_found = true;
 
         // Debug output (record this data as metric for engine performance)
@@ -482,24 +327,57 @@ thc::Move NaiveOMPEngine::solve(thc::ChessRules& cr, bool is_white_player) {
         std::cout << "Depth: " <<  current_depth 
         << ", Score: " << (current_score / 100.0f) 
         << ", Time: " << elapsed_seconds.count() << "s" 
-        << ", Nodes Evaluated = " << debug_node_count 
-        << ", knps: " << (debug_node_count/1000.0) / elapsed_seconds.count() 
+        << ", Nodes Evaluated = " << iteration[search_stats::EVALUATED] 
+        << ", knps: " << (iteration[search_stats::EVALUATED]/1000.0) / elapsed_seconds.count() 
         << std::endl;
+        if (perf_counters::enabled()) {
+            std::cout << "Hardware: " << perf_counters::describe(hardware, iteration[search_stats::EVALUATED]) << std::endl;
+        }
+
+        if (telemetry::enabled()) {
+            telemetry::Iteration record;
+            record.engine = "naive-omp";
+            record.depth = current_depth;
+            record.score = current_score;
+            record.pv = result.pv;
+            record.seconds = elapsed_seconds.count();
+            record.branching_factor = timer.branching_factor();
+            record.counters = iteration;
+            record.hardware = hardware;
+            for (const auto& counters : stats) {
+                record.workers.push_back(counters[search_stats::EVALUATED]);
+            }
+            telemetry::iteration(record);
+        }
     }
 
-    if (move_found) {
-        return best_move_so_far;
-    } else {
+    profile::report(profile::collect());
+    if (perf_counters::enabled()) {
+        std::vector<perf_counters::Values> per_thread = perf_counters::difference(perf_counters::read(), search_counters);
+        std::cout << "Hardware, whole search: " << perf_counters::describe(perf_counters::total(per_thread), nodes_searched) << std::endl;
+        for (size_t t = 0; t < per_thread.size() && t < thread_nodes.size(); t++) {
+            std::cout << "  Thread " << t << ": " << perf_counters::describe(per_thread[t], thread_nodes[t]) << std::endl;
+        }
+    }
+
+    if (!move_found) {
         // If no move was found (unlikely), generate a random legal move
         std::vector<thc::Move> legal_moves;
         cr.GenLegalMoveList(legal_moves);
         if (!legal_moves.empty()) {
-            return legal_moves[0];
+            result.best_move = legal_moves[0];
         } else {
             // No legal moves, return a default move
-            return thc::Move();
+            result.best_move = thc::Move();
         }
+        result.pv.assign(1, result.best_move);
     }
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::steady_clock::now() - start_time;
+    result.nodes = nodes_searched;
+    result.workers = thread_nodes;
+    result.time = elapsed_seconds.count();
+    return result;
 }
 
 NaiveOMPEngine::Score NaiveOMPEngine::solve_naive_omp_engine(
@@ -509,21 +387,29 @@ NaiveOMPEngine::Score NaiveOMPEngine::solve_naive_omp_engine(
     int depth,
     int max_depth,
     Score alpha_score,
-    Score beta_score
+    Score beta_score,
+    const eval_kernel::BoardSummary* leaf_board
 ) {
+    search_stats::Counters& node_stats = thread_stats();
+    node_stats.add(search_stats::NODES);
+    node_stats.reach(depth);
+
     // Check if time limit has been reached
     if (time_limit_reached) {
         return 0.0f;
     }
 
-    // Check time at certain intervals to minimize performance impact (we do mod 5)
-    if (depth % 5 == 0) { 
-        auto current_time = std::chrono::steady_clock::now();
-        std::chrono::duration<double> elapsed_seconds = current_time - start_time;
-        if (elapsed_seconds.count() >= TIME_LIMIT_SECONDS) {
-            time_limit_reached = true;
-            return 0.0f;
-        }
+    // The node count is spread over the threads' counters, so each thread adds it up only every few hundred nodes
+    if (node_limit > 0 && node_stats[search_stats::NODES] % NODE_LIMIT_INTERVAL == 0
+            && nodes_searched + search_stats::total(stats)[search_stats::EVALUATED] >= node_limit) {
+        time_limit_reached = true;
+        return 0.0f;
+    }
+
+    // The time manager reads the clock every few thousand nodes
+    if (timer.poll()) {
+        time_limit_reached = true;
+        return 0.0f;
     }
 
     thc::DRAWTYPE draw_reason;
@@ -535,20 +421,20 @@ NaiveOMPEngine::Score NaiveOMPEngine::solve_naive_omp_engine(
     thc::TERMINAL terminal;
     if (cr.Evaluate(terminal)) {
         if (terminal == thc::TERMINAL_WCHECKMATE) {
-            debug_node_count++;
+            node_stats.add(search_stats::EVALUATED);
             return -INF_SCORE + depth; // White is checkmated
         } else if (terminal == thc::TERMINAL_BCHECKMATE) {
-            debug_node_count++;
+            node_stats.add(search_stats::EVALUATED);
             return INF_SCORE - depth; // Black is checkmated
         } else if (terminal == thc::TERMINAL_WSTALEMATE || terminal == thc::TERMINAL_BSTALEMATE) {
-            debug_node_count++;
+            node_stats.add(search_stats::EVALUATED);
             return 0.0f; // Stalemate is a draw
         }
     }
 
     if (depth == max_depth) {
-        debug_node_count++;
-        return static_eval(cr);
+        node_stats.add(search_stats::EVALUATED);
+        return leaf_board ? static_eval(cr, *leaf_board) : static_eval(cr);
     }
 
     std::vector<thc::Move> legal_moves;
@@ -561,6 +447,16 @@ NaiveOMPEngine::Score NaiveOMPEngine::solve_naive_omp_engine(
 
     Score best_score = is_white_player ? -INF_SCORE : INF_SCORE;
 
+    // A ply above the leaves every child is a leaf, and all of them are searched, so their summaries are made
+    // together from this node's, a batch at a time (see eval-kernel.h), before the threads share them out
+    std::vector<eval_kernel::BoardSummary> leaves;
+    if (depth == max_depth - 1) {
+        eval_kernel::BoardSummary board;
+        eval_kernel::summarise(cr.squares, board);
+        leaves.resize(legal_moves.size());
+        eval_kernel::summarise_children(cr.squares, board, legal_moves.data(), legal_moves.size(), leaves.data());
+    }
+
     int done_flag = 0;
 
     // #pragma omp parallel for schedule(dynamic)
@@ -588,7 +484,8 @@ NaiveOMPEngine::Score NaiveOMPEngine::solve_naive_omp_engine(
             depth + 1,
             max_depth,
             alpha_score,
-            beta_score
+            beta_score,
+            leaves.empty() ? nullptr : &leaves[i]
         );
 
         if (is_white_player) current_score = -current_score;
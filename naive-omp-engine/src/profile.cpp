@@ -0,0 +1,155 @@
+/*
+ *  profile
+ *
+ *  See profile.h. Every thread that enters a zone gets an Accumulator of its own, listed in a registry so
+ *  collect() can find them all. A thread that exits (an OpenMP pool being resized, a search thread being
+ *  joined) folds its totals into the registry's before its Accumulator goes.
+ */
+
+#include "profile.h"
+
+#ifdef SEARCH_PROFILE
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <mutex>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace profile {
+
+namespace {
+
+struct Accumulator;
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<Accumulator*> threads;
+    Totals retired;             // of threads that have exited since begin()
+    uint64_t search_start = 0;
+};
+
+Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+struct Accumulator {
+    Totals totals;
+    int current = -1;           // zone the thread is in, -1 for none
+
+    Accumulator() {
+        std::lock_guard<std::mutex> lock(registry().mutex);
+        registry().threads.push_back(this);
+    }
+
+    ~Accumulator() {
+        Registry& all = registry();
+        std::lock_guard<std::mutex> lock(all.mutex);
+        for (int zone = 0; zone < ZONE_COUNT; zone++) {
+            all.retired.cycles[zone] += totals.cycles[zone];
+            all.retired.calls[zone] += totals.calls[zone];
+        }
+        for (size_t i = 0; i < all.threads.size(); i++) {
+            if (all.threads[i] == this) {
+                all.threads.erase(all.threads.begin() + i);
+                break;
+            }
+        }
+    }
+};
+
+thread_local Accumulator accumulator;
+
+} // namespace
+
+uint64_t ticks() {
+#if defined(__x86_64__) || defined(__i386__)
+    return __rdtsc();
+#else
+    // No time stamp counter to read: nanoseconds stand in for cycles
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+ScopedZone::ScopedZone(Zone zone) : zone(zone), parent(accumulator.current) {
+    accumulator.current = zone;
+    start = ticks();
+}
+
+ScopedZone::~ScopedZone() {
+    uint64_t elapsed = ticks() - start;
+    Totals& totals = accumulator.totals;
+    totals.cycles[zone] += elapsed;
+    totals.calls[zone]++;
+    // The outer zone's time includes this one's: take it off, the counts wrap around to the right total
+    if (parent >= 0) {
+        totals.cycles[parent] -= elapsed;
+    }
+    accumulator.current = parent;
+}
+
+void begin() {
+    Registry& all = registry();
+    std::lock_guard<std::mutex> lock(all.mutex);
+    for (Accumulator* thread : all.threads) {
+        thread->totals = Totals();
+    }
+    all.retired = Totals();
+    all.search_start = ticks();
+}
+
+Totals collect() {
+    Registry& all = registry();
+    std::lock_guard<std::mutex> lock(all.mutex);
+    Totals sum = all.retired;
+    for (const Accumulator* thread : all.threads) {
+        for (int zone = 0; zone < ZONE_COUNT; zone++) {
+            sum.cycles[zone] += thread->totals.cycles[zone];
+            sum.calls[zone] += thread->totals.calls[zone];
+        }
+    }
+    sum.search_cycles = ticks() - all.search_start;
+    return sum;
+}
+
+void report(const Totals& totals) {
+    // Threads searching side by side spend more cycles than the search lasts, so shares are of the zones' total
+    // when that is the larger
+    uint64_t zone_cycles = 0;
+    for (int zone = 0; zone < ZONE_COUNT; zone++) {
+        zone_cycles += totals.cycles[zone];
+    }
+    double whole = (double)std::max(totals.search_cycles, zone_cycles);
+    if (whole <= 0) {
+        return;
+    }
+
+    char line[128];
+    std::cout << "Profile (" << totals.search_cycles / 1000000 << " Mcycles):" << std::endl;
+    for (int zone = 0; zone < ZONE_COUNT; zone++) {
+        uint64_t calls = totals.calls[zone];
+        if (calls == 0) {
+            continue;       // a zone this engine does not have
+        }
+        std::snprintf(line, sizeof(line), "  %-18s %6.2f%%  %10llu calls  %8.1f cycles/call", ZONE_NAMES[zone],
+                      100.0 * totals.cycles[zone] / whole, (unsigned long long)calls,
+                      (double)totals.cycles[zone] / calls);
+        std::cout << line << std::endl;
+    }
+    if (totals.search_cycles > zone_cycles) {
+        std::snprintf(line, sizeof(line), "  %-18s %6.2f%%", "other",
+                      100.0 * (totals.search_cycles - zone_cycles) / whole);
+        std::cout << line << std::endl;
+    }
+}
+
+} // namespace profile
+
+#endif // SEARCH_PROFILE
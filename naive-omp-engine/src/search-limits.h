@@ -0,0 +1,65 @@
+#ifndef SEARCH_LIMITS_H
+#define SEARCH_LIMITS_H
+
+/*
+ *  search-limits
+ *
+ *  What one call to solve() may spend, and what it reports back. The fields follow the UCI "go" command:
+ *  a fixed depth, node count or time per move, a game clock with increment, a mate search, or no limit at all.
+ *  Anything left at zero is not a limit. When nothing is set the engine falls back to its own default depth
+ *  and time limit, so solve(cr, side) still searches the way it always has.
+ *
+ *  main.cpp fills the limits from the command line (parse_flag), which lets the same binary run at any
+ *  strength or budget. How much of a clock one move gets is up to time-manager.
+ */
+
+#include <cstdint>
+#include <vector>
+#include "thc.h"
+
+namespace search_limits {
+
+// Deepest iteration any search goes to (the move ordering tables are sized for this many plies)
+constexpr int MAX_SEARCH_DEPTH = 64;
+
+struct SearchLimits {
+    int depth = 0;              // plies
+    uint64_t nodes = 0;         // nodes evaluated, over all iterations
+    int64_t movetime = 0;       // milliseconds for this move
+    int64_t wtime = 0;          // milliseconds left on each side's clock
+    int64_t btime = 0;
+    int64_t winc = 0;           // milliseconds added to each side's clock after its move
+    int64_t binc = 0;
+    int mate = 0;               // look for a mate in this many moves
+    bool infinite = false;      // search until stopped (or MAX_SEARCH_DEPTH)
+
+    // Deepest iteration to search, given the engine's default depth
+    int max_depth(int default_depth) const;
+
+    // Whether the search plays on a game clock
+    bool on_clock() const { return wtime > 0 || btime > 0; }
+
+    // Take elapsed_ms off the clock of the side that just moved and add its increment
+    void spend(bool white, int64_t elapsed_ms);
+};
+
+struct SearchResult {
+    thc::Move best_move;
+    float score = 0.0f;         // white minus black, centipawns
+    std::vector<thc::Move> pv;  // principal variation, starting with best_move
+    int depth = 0;              // deepest completed iteration
+    uint64_t nodes = 0;         // nodes evaluated, over all iterations
+    std::vector<uint64_t> workers;  // of those, the nodes of each thread or rank (MPI: on rank 0 only)
+    double time = 0.0;          // seconds
+};
+
+// Read the search limit flag at argv[i] (--depth, --nodes, --movetime, --wtime, --btime, --winc, --binc,
+// --mate or --infinite), moving i past its value. False if argv[i] is not one of them or has no valid value.
+bool parse_flag(int argc, char* argv[], int& i, SearchLimits& limits);
+
+// One line describing the flags, for usage messages
+const char* usage();
+
+} // namespace search_limits
+
+#endif // SEARCH_LIMITS_H
@@ -0,0 +1,196 @@
+#ifndef EVAL_KERNEL_H
+#define EVAL_KERNEL_H
+
+/*
+ *  eval-kernel
+ *
+ *  Material + piece-square evaluation of a whole board in one pass. The per-piece heat maps below are merged
+ *  with the material values into a single int16 table indexed by [piece][square], with the black rows already
+ *  flipped (63 - i) and negated, so a board scores as a plain sum of table[piece_on(i)][i].
+ *
+ *  On x86 CPUs with AVX2 the board is classified with byte compares and scored with 8 gathers; everywhere else
+ *  (or when built with -DEVAL_KERNEL_SCALAR) a scalar loop over the same table is used. Both produce identical
+ *  results, and both also hand back one occupancy bitboard per piece so callers can count material, find kings
+ *  and read pawn files without scanning the board again.
+ *
+ *  The children of a board can also be summarised together from the board's own summary (summarise_children):
+ *  a move changes at most 4 squares, so each child only costs those, and the AVX2 path scores the same change of
+ *  8 children with one gather.
+ */
+
+#include <cstdint>
+#include "thc.h"
+
+namespace eval_kernel {
+
+// Row indices into the merged table, 0 is the empty square
+enum PieceCode {
+    EMPTY = 0,
+    WP, WN, WB, WR, WQ, WK,
+    BP, BN, BB, BR, BQ, BK,
+    NUM_PIECE_CODES
+};
+
+// Piece values (the king is worth a lot so missing kings show up, but it cancels out in every real position)
+constexpr int PAWN_VALUE   = 100;
+constexpr int KNIGHT_VALUE = 320;
+constexpr int BISHOP_VALUE = 330;
+constexpr int ROOK_VALUE   = 500;
+constexpr int QUEEN_VALUE  = 900;
+constexpr int KING_VALUE   = 20000;
+
+// Piece-square tables for evaluation (a.k.a. heat maps), from white's point of view, a8 = 0
+constexpr int pawn_table[64] = {
+     0,  0,  0,  0,  0,  0,  0,  0,
+    50, 50, 50, 50, 50, 50, 50, 50,
+    10, 10, 20, 30, 30, 20, 10, 10,
+     5,  5, 10, 25, 25, 10,  5,  5,
+     0,  0,  0, 20, 20,  0,  0,  0,
+     5, -5,-10,  0,  0,-10, -5,  5,
+     5, 10, 10,-20,-20, 10, 10,  5,
+     0,  0,  0,  0,  0,  0,  0,  0
+};
+
+constexpr int knight_table[64] = {
+    -50,-40,-30,-30,-30,-30,-40,-50,
+    -40,-20,  0,  0,  0,  0,-20,-40,
+    -30,  0, 10, 15, 15, 10,  0,-30,
+    -30,  5, 15, 20, 20, 15,  5,-30,
+    -30,  0, 15, 20, 20, 15,  0,-30,
+    -30,  5, 10, 15, 15, 10,  5,-30,
+    -40,-20,  0,  5,  5,  0,-20,-40,
+    -50,-40,-30,-30,-30,-30,-40,-50
+};
+
+constexpr int bishop_table[64] = {
+    -20,-10,-10,-10,-10,-10,-10,-20,
+    -10,  0,  0,  0,  0,  0,  0,-10,
+    -10,  0,  5, 10, 10,  5,  0,-10,
+    -10,  5,  5, 10, 10,  5,  5,-10,
+    -10,  0, 10, 10, 10, 10,  0,-10,
+    -10, 10, 10, 10, 10, 10, 10,-10,
+    -10,  5,  0,  0,  0,  0,  5,-10,
+    -20,-10,-10,-10,-10,-10,-10,-20
+};
+
+constexpr int rook_table[64] = {
+     0,  0,  0,  0,  0,  0,  0,  0,
+     5, 10, 10, 10, 10, 10, 10,  5,
+    -5,  0,  0,  0,  0,  0,  0, -5,
+    -5,  0,  0,  0,  0,  0,  0, -5,
+    -5,  0,  0,  0,  0,  0,  0, -5,
+    -5,  0,  0,  0,  0,  0,  0, -5,
+    -5,  0,  0,  0,  0,  0,  0, -5,
+     0,  0,  0,  5,  5,  0,  0,  0
+};
+
+constexpr int queen_table[64] = {
+    -20,-10,-10, -5, -5,-10,-10,-20,
+    -10,  0,  0,  0,  0,  0,  0,-10,
+    -10,  0,  5,  5,  5,  5,  0,-10,
+     -5,  0,  5,  5,  5,  5,  0, -5,
+      0,  0,  5,  5,  5,  5,  0, -5,
+    -10,  5,  5,  5,  5,  5,  0,-10,
+    -10,  0,  5,  0,  0,  0,  0,-10,
+    -20,-10,-10, -5, -5,-10,-10,-20
+};
+
+constexpr int king_table[64] = {
+    -30,-40,-40,-50,-50,-40,-40,-30,
+    -30,-40,-40,-50,-50,-40,-40,-30,
+    -30,-40,-40,-50,-50,-40,-40,-30,
+    -30,-40,-40,-50,-50,-40,-40,-30,
+    -20,-30,-30,-40,-40,-30,-30,-20,
+    -10,-20,-20,-20,-20,-20,-20,-10,
+     20, 20,  0,  0,  0,  0, 20, 20,
+     20, 30, 10,  0,  0, 10, 30, 20
+};
+
+// Merged material + piece-square table, white minus black. One spare row pads the AVX2 gathers.
+struct alignas(32) PsqtTable {
+    int16_t rows[NUM_PIECE_CODES + 1][64];
+};
+extern const PsqtTable psqt;
+
+// Piece code of every thc square character ('P', 'n', ' ', ...)
+struct PieceCodeTable {
+    uint8_t codes[256];
+};
+extern const PieceCodeTable piece_codes;
+
+inline int piece_code(char piece) {
+    return piece_codes.codes[static_cast<uint8_t>(piece)];
+}
+
+// Result of scanning one board
+struct BoardSummary {
+    int material_pst;                       // material + piece-square score, white minus black
+    uint64_t bitboards[NUM_PIECE_CODES];    // bit i set when square i holds that piece ([EMPTY] = empty squares)
+};
+
+// Score and classify a board (squares as in thc::ChessPositionRaw::squares)
+void summarise(const char* squares, BoardSummary& out);
+
+// The two implementations behind summarise(), exposed for benchmarking
+void summarise_scalar(const char* squares, BoardSummary& out);
+bool avx2_available();
+void summarise_avx2(const char* squares, BoardSummary& out);   // only call when avx2_available()
+
+// Name of the implementation summarise() dispatches to ("avx2" or "scalar")
+const char* backend_name();
+
+constexpr int BATCH_SIZE = 8;       // children summarised per call, one AVX2 gather wide
+constexpr int MAX_CHANGES = 4;      // squares a move changes: 2, 3 for en passant, 4 for castling
+
+// Children of one board, by the squares each one's move changes: the merged table entry (code * 64 + square) of
+// the square before and after the move, change by change. Unused changes are 0 in both, which scores nothing.
+struct ChildBatch {
+    int count = 0;
+    int32_t before[MAX_CHANGES][BATCH_SIZE] = {};
+    int32_t after[MAX_CHANGES][BATCH_SIZE] = {};
+};
+
+// Add the child reached by move from squares to a batch that is not yet full
+void add_child(ChildBatch& batch, const char* squares, const thc::Move& move);
+
+// Summaries of the children in batch (out[0 .. batch.count - 1]) from their parent's summary, in one call
+void summarise_children(const BoardSummary& parent, const ChildBatch& batch, BoardSummary* out);
+
+// Summaries of the children reached by moves[0 .. count - 1] from squares, whose summary is parent, a batch per call
+void summarise_children(const char* squares, const BoardSummary& parent, const thc::Move* moves, int count,
+                        BoardSummary* out);
+
+// The two implementations behind summarise_children(), exposed for benchmarking
+void summarise_children_scalar(const BoardSummary& parent, const ChildBatch& batch, BoardSummary* out);
+void summarise_children_avx2(const BoardSummary& parent, const ChildBatch& batch, BoardSummary* out);
+
+inline int piece_count(const BoardSummary& board, int code) {
+    return __builtin_popcountll(board.bitboards[code]);
+}
+
+// Non-king material of one side
+inline int material(const BoardSummary& board, bool white) {
+    int base = white ? WP : BP;
+    return piece_count(board, base + 0) * PAWN_VALUE
+         + piece_count(board, base + 1) * KNIGHT_VALUE
+         + piece_count(board, base + 2) * BISHOP_VALUE
+         + piece_count(board, base + 3) * ROOK_VALUE
+         + piece_count(board, base + 4) * QUEEN_VALUE;
+}
+
+// Square of a side's king, -1 if there is none
+inline int king_square(const BoardSummary& board, bool white) {
+    uint64_t bb = board.bitboards[white ? WK : BK];
+    return bb ? __builtin_ctzll(bb) : -1;
+}
+
+// Piece-square gain of moving a piece from one square to another, from the mover's point of view
+inline int psqt_delta(char piece, int from, int to) {
+    int code = piece_code(piece);
+    int delta = psqt.rows[code][to] - psqt.rows[code][from];
+    return code >= BP ? -delta : delta;
+}
+
+} // namespace eval_kernel
+
+#endif // EVAL_KERNEL_H
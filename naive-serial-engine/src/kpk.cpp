@@ -0,0 +1,30 @@
+/*
+ *  kpk
+ *
+ *  See kpk.h. Probing flips the board so the pawn is white and on files a-d, the only positions the bitbase
+ *  stores.
+ */
+
+#include "kpk.h"
+#include "kpk-bitbase.h"
+
+namespace kpk {
+
+bool probe(bool strong_white, bool strong_to_move, int strong_king, int pawn, int weak_king) {
+    if (!strong_white) {
+        // Flip ranks so the pawn moves up the board
+        strong_king ^= 56;
+        weak_king ^= 56;
+        pawn ^= 56;
+    }
+    if (pawn % 8 >= 4) {
+        // Mirror files onto the queen side
+        strong_king ^= 7;
+        weak_king ^= 7;
+        pawn ^= 7;
+    }
+    int i = index(strong_to_move, strong_king, weak_king, pawn);
+    return (kpk_bitbase[i / 64] >> (i % 64)) & 1;
+}
+
+} // namespace kpk
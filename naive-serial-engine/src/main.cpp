@@ -7,9 +7,13 @@
 
 #include <iostream>
 #include <string>
+#include <chrono>
 #include <vector>
 #include <algorithm>
 #include "thc.h"
+#include "search-limits.h"
+#include "telemetry.h"
+#include "perf-counters.h"
 #include "naive-serial-engine.h"
 
 void print_board(thc::ChessRules& cr) {
@@ -21,17 +25,35 @@ int main(int argc, char* argv[]) {
     bool computer_is_black = false;
 
     // Parse command-line arguments
-    if (argc > 1) {
-        std::string arg = argv[1];
+    search_limits::SearchLimits limits;
+    std::string telemetry_target;
+    bool count_hardware = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
         if (arg == "--white") {
             computer_is_white = true;
         } else if (arg == "--black") {
             computer_is_black = true;
-        } else {
-            std::cout << "Usage: " << argv[0] << " [--white | --black]" << std::endl;
+        } else if (arg == "--telemetry" && i + 1 < argc) {
+            telemetry_target = argv[++i];
+        } else if (arg == "--perf-counters") {
+            count_hardware = true;
+        } else if (!search_limits::parse_flag(argc, argv, i, limits)) {
+            std::cout << "Usage: " << argv[0] << " [--white | --black] " << search_limits::usage() << " " << telemetry::usage() << " " << perf_counters::usage() << std::endl;
             return 1;
         }
-    } else {
+    }
+    if (!telemetry_target.empty() && !telemetry::open(telemetry_target)) {
+        std::cout << "Cannot open telemetry output " << telemetry_target << std::endl;
+        return 1;
+    }
+    std::string counters_error;
+    if (count_hardware && !perf_counters::open(counters_error)) {
+        std::cout << "Cannot open hardware counters: " << counters_error << std::endl;
+        return 1;
+    }
+    if (!computer_is_white && !computer_is_black) {
         // Default to computer playing black
         computer_is_black = true;
     }
@@ -45,11 +67,14 @@ int main(int argc, char* argv[]) {
     bool game_over = false;
     thc::TERMINAL terminal;
 
+    // Both sides' thinking time comes off their clocks, when playing on one
+    auto move_start = std::chrono::steady_clock::now();
+
     while (!game_over) {
         if (cr.WhiteToPlay()) {
             if (computer_is_white) {
                 // Computer's turn
-                thc::Move best_move = engine.solve(cr, true);
+                thc::Move best_move = engine.solve(cr, true, limits).best_move;
                 std::cout << "Computer (White) plays: " << best_move.NaturalOut(&cr) << std::endl;
                 cr.PushMove(best_move);
             } else {
@@ -77,7 +102,7 @@ int main(int argc, char* argv[]) {
         } else {
             if (computer_is_black) {
                 // Computer's turn
-                thc::Move best_move = engine.solve(cr, false);
+                thc::Move best_move = engine.solve(cr, false, limits).best_move;
                 std::cout << "Computer (Black) plays: " << best_move.NaturalOut(&cr) << std::endl;
                 cr.PushMove(best_move);
             } else {
@@ -104,6 +129,10 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        auto move_end = std::chrono::steady_clock::now();
+        limits.spend(!cr.WhiteToPlay(), std::chrono::duration_cast<std::chrono::milliseconds>(move_end - move_start).count());
+        move_start = move_end;
+
         // Display the board
         print_board(cr);
 
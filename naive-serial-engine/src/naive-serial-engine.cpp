@@ -12,73 +12,6 @@
 #include <cmath>    
 #include <iostream>
 
-// Piece-square tables for evaluation (a.k.a. heat maps)
-const int pawn_table[64] = {
-     0,  0,  0,  0,  0,  0,  0,  0,
-    50, 50, 50, 50, 50, 50, 50, 50,
-    10, 10, 20, 30, 30, 20, 10, 10,
-     5,  5, 10, 25, 25, 10,  5,  5,
-     0,  0,  0, 20, 20,  0,  0,  0,
-     5, -5,-10,  0,  0,-10, -5,  5,
-     5, 10, 10,-20,-20, 10, 10,  5,
-     0,  0,  0,  0,  0,  0,  0,  0
-};
-
-const int knight_table[64] = {
-    -50,-40,-30,-30,-30,-30,-40,-50,
-    -40,-20,  0,  0,  0,  0,-20,-40,
-    -30,  0, 10, 15, 15, 10,  0,-30,
-    -30,  5, 15, 20, 20, 15,  5,-30,
-    -30,  0, 15, 20, 20, 15,  0,-30,
-    -30,  5, 10, 15, 15, 10,  5,-30,
-    -40,-20,  0,  5,  5,  0,-20,-40,
-    -50,-40,-30,-30,-30,-30,-40,-50
-};
-
-const int bishop_table[64] = {
-    -20,-10,-10,-10,-10,-10,-10,-20,
-    -10,  0,  0,  0,  0,  0,  0,-10,
-    -10,  0,  5, 10, 10,  5,  0,-10,
-    -10,  5,  5, 10, 10,  5,  5,-10,
-    -10,  0, 10, 10, 10, 10,  0,-10,
-    -10, 10, 10, 10, 10, 10, 10,-10,
-    -10,  5,  0,  0,  0,  0,  5,-10,
-    -20,-10,-10,-10,-10,-10,-10,-20
-};
-
-const int rook_table[64] = {
-     0,  0,  0,  0,  0,  0,  0,  0,
-     5, 10, 10, 10, 10, 10, 10,  5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-     0,  0,  0,  5,  5,  0,  0,  0
-};
-
-const int queen_table[64] = {
-    -20,-10,-10, -5, -5,-10,-10,-20,
-    -10,  0,  0,  0,  0,  0,  0,-10,
-    -10,  0,  5,  5,  5,  5,  0,-10,
-     -5,  0,  5,  5,  5,  5,  0, -5,
-      0,  0,  5,  5,  5,  5,  0, -5,
-    -10,  5,  5,  5,  5,  5,  0,-10,
-    -10,  0,  5,  0,  0,  0,  0,-10,
-    -20,-10,-10, -5, -5,-10,-10,-20
-};
-
-const int king_table[64] = {
-    -30,-40,-40,-50,-50,-40,-40,-30,
-    -30,-40,-40,-50,-50,-40,-40,-30,
-    -30,-40,-40,-50,-50,-40,-40,-30,
-    -30,-40,-40,-50,-50,-40,-40,-30,
-    -20,-30,-30,-40,-40,-30,-30,-20,
-    -10,-20,-20,-20,-20,-20,-20,-10,
-     20, 20,  0,  0,  0,  0, 20, 20,
-     20, 30, 10,  0,  0, 10, 30, 20
-};
-
 /* Helper function for move scoring. Capturing larger piece is prioritized first.
  */
 
@@ -106,36 +39,13 @@ float NaiveSerialEngine::score_move(const thc::Move& move, thc::ChessRules& cr)
     // Positional gain
     int from_index = static_cast<int>(move.src);
     int to_index = static_cast<int>(move.dst);
-    char piece = cr.squares[from_index];
-
-    if (isupper(piece)) { // White pieces
-        switch (piece) {
-            case 'P': score += (pawn_table[to_index] - pawn_table[from_index]) / 100.0f; break;
-            case 'N': score += (knight_table[to_index] - knight_table[from_index]) / 100.0f; break;
-            case 'B': score += (bishop_table[to_index] - bishop_table[from_index]) / 100.0f; break;
-            case 'R': score += (rook_table[to_index] - rook_table[from_index]) / 100.0f; break;
-            case 'Q': score += (queen_table[to_index] - queen_table[from_index]) / 100.0f; break;
-            case 'K': score += (king_table[to_index] - king_table[from_index]) / 100.0f; break;
-        }
-    } else { // Black pieces
-        int flipped_from_index = 63 - from_index;
-        int flipped_to_index = 63 - to_index;
-
-        switch (piece) {
-            case 'p': score += (pawn_table[flipped_to_index] - pawn_table[flipped_from_index]) / 100.0f; break;
-            case 'n': score += (knight_table[flipped_to_index] - knight_table[flipped_from_index]) / 100.0f; break;
-            case 'b': score += (bishop_table[flipped_to_index] - bishop_table[flipped_from_index]) / 100.0f; break;
-            case 'r': score += (rook_table[flipped_to_index] - rook_table[flipped_from_index]) / 100.0f; break;
-            case 'q': score += (queen_table[flipped_to_index] - queen_table[flipped_from_index]) / 100.0f; break;
-            case 'k': score += (king_table[flipped_to_index] - king_table[flipped_from_index]) / 100.0f; break;
-        }
-    }
+    score += eval_kernel::psqt_delta(cr.squares[from_index], from_index, to_index) / 100.0f;
 
     return score;
 }
 
 // Add a mobility bonus for the pieces (not sure if this helps).
-int NaiveSerialEngine::evaluate_mobility(thc::ChessRules& cr, bool is_white, const std::vector<int>& piece_indices) {
+int NaiveSerialEngine::evaluate_mobility(thc::ChessRules& cr, bool is_white) {
     int mobility_score = 0;
     thc::ChessRules cr_copy = cr;
     std::vector<thc::Move> moves;
@@ -158,13 +68,13 @@ int NaiveSerialEngine::evaluate_mobility(thc::ChessRules& cr, bool is_white, con
     return mobility_score;
 }
 
-int NaiveSerialEngine::evaluate_pawn_structure(const std::vector<int>& pawn_files, bool is_white) {
+int NaiveSerialEngine::evaluate_pawn_structure(uint64_t pawns, bool is_white) {
     int score = 0;
 
     // Count pawns on each file
     int file_counts[8] = {0};
-    for (int file : pawn_files) {
-        file_counts[file]++;
+    for (int i = 0; i < 8; ++i) {
+        file_counts[i] = __builtin_popcountll(pawns & (0x0101010101010101ULL << i));
     }
 
     // Evaluate pawn structure
@@ -277,144 +187,44 @@ int NaiveSerialEngine::evaluate_king_activity(int own_king_index, int opponent_k
 }
 
 
-const int ENDGAME_MATERIAL_THRESHOLD = 2400; // Adjust based on testing
-
-bool NaiveSerialEngine::is_endgame(int white_material, int black_material) {
-    int total_material = white_material + black_material;
-    return total_material <= ENDGAME_MATERIAL_THRESHOLD; // Define a threshold, e.g., 2400 (two rooks)
+NaiveSerialEngine::Score NaiveSerialEngine::static_eval(thc::ChessRules& cr) {
+    // Evaluate material and positional bonuses for the whole board at once (see eval-kernel.h)
+    eval_kernel::BoardSummary board;
+    eval_kernel::summarise(cr.squares, board);
+    return static_eval(cr, board);
 }
 
-NaiveSerialEngine::Score NaiveSerialEngine::static_eval(thc::ChessRules& cr) {
-    Score total_score = 0.0f;
+NaiveSerialEngine::Score NaiveSerialEngine::static_eval(thc::ChessRules& cr, const eval_kernel::BoardSummary& board) {
+    PROFILE_ZONE(profile::STATIC_EVAL);
+    Score total_score = board.material_pst;
 
-    // Material counts
-    int white_material = 0;
-    int black_material = 0;
+    // Game phase, scaling and endgame type for this material (see material-table.h)
+    material_table::Entry material = material_table::probe(cr.material_key);
 
-    // Piece counts for bishop pair evaluation
-    int white_bishops = 0;
-    int black_bishops = 0;
+    // Specialised endgames (KPK, KQK, KRK, KBNK, KRKP) have an evaluator of their own (see endgame.h)
+    if (material.endgame != material_table::ENDGAME_NONE) {
+        return endgame::evaluate(material.endgame, board, material.strong_white, cr.WhiteToPlay());
+    }
 
     // King positions
-    int white_king_index = -1;
-    int black_king_index = -1;
-
-    // Variables for pawn structure
-    std::vector<int> white_pawn_files;
-    std::vector<int> black_pawn_files;
-
-    // Piece positions for mobility evaluation
-    std::vector<int> white_piece_indices;
-    std::vector<int> black_piece_indices;
-
-    // Evaluate material and positional bonuses
-    for (int i = 0; i < 64; i++) {
-        char piece = cr.squares[i];
-        if (piece == ' ')
-            continue;
-
-        int index = i;
-        int flipped_index = 63 - i; // Flips the board for Black
-        int piece_value = 0;
-        float positional_bonus = 0.0f;
-
-        bool is_white = isupper(piece);
-        char lower_piece = tolower(piece);
-
-        switch (lower_piece) {
-            case 'p':
-                piece_value = 100;
-                positional_bonus = pawn_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_pawn_files.push_back(index % 8);
-                } else {
-                    black_material += piece_value;
-                    black_pawn_files.push_back(index % 8);
-                }
-                break;
-            case 'n':
-                piece_value = 320;
-                positional_bonus = knight_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_piece_indices.push_back(index);
-                } else {
-                    black_material += piece_value;
-                    black_piece_indices.push_back(index);
-                }
-                break;
-            case 'b':
-                piece_value = 330;
-                positional_bonus = bishop_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_bishops++;
-                    white_piece_indices.push_back(index);
-                } else {
-                    black_material += piece_value;
-                    black_bishops++;
-                    black_piece_indices.push_back(index);
-                }
-                break;
-            case 'r':
-                piece_value = 500;
-                positional_bonus = rook_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_piece_indices.push_back(index);
-                } else {
-                    black_material += piece_value;
-                    black_piece_indices.push_back(index);
-                }
-                break;
-            case 'q':
-                piece_value = 900;
-                positional_bonus = queen_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_piece_indices.push_back(index);
-                } else {
-                    black_material += piece_value;
-                    black_piece_indices.push_back(index);
-                }
-                break;
-            case 'k':
-                piece_value = 20000; // High value for the King
-                positional_bonus = king_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_king_index = index;
-                } else {
-                    black_king_index = index;
-                }
-                break;
-            default:
-                break;
-        }
-
-        Score square_score = piece_value + positional_bonus;
-        if (is_white) {
-            total_score += square_score;
-        } else {
-            total_score -= square_score;
-        }
-    }
+    int white_king_index = eval_kernel::king_square(board, true);
+    int black_king_index = eval_kernel::king_square(board, false);
 
     // Bishop pair bonus
-    if (white_bishops >= 2) total_score += 50;
-    if (black_bishops >= 2) total_score -= 50;
+    if (eval_kernel::piece_count(board, eval_kernel::WB) >= 2) total_score += 50;
+    if (eval_kernel::piece_count(board, eval_kernel::BB) >= 2) total_score -= 50;
 
     // Mobility evaluation
-    total_score += evaluate_mobility(cr, true, white_piece_indices);
-    total_score -= evaluate_mobility(cr, false, black_piece_indices);
+    total_score += evaluate_mobility(cr, true);
+    total_score -= evaluate_mobility(cr, false);
 
     // Pawn structure evaluation
-    total_score += evaluate_pawn_structure(white_pawn_files, true);
-    total_score -= evaluate_pawn_structure(black_pawn_files, false);
+    total_score += evaluate_pawn_structure(board.bitboards[eval_kernel::WP], true);
+    total_score -= evaluate_pawn_structure(board.bitboards[eval_kernel::BP], false);
 
     // King safety evaluation
 
-    bool endgame = is_endgame(white_material, black_material);
+    bool endgame = material.flags & material_table::ENDGAME;
 
     total_score += evaluate_king_safety(cr, white_king_index, true, endgame);
     total_score -= evaluate_king_safety(cr, black_king_index, false, endgame);
@@ -427,26 +237,34 @@ NaiveSerialEngine::Score NaiveSerialEngine::static_eval(thc::ChessRules& cr) {
         total_score -= evaluate_king_activity(black_king_index, white_king_index, false);
     }
 
-
-    return total_score;
+    // Pull the score towards a draw when the side ahead lacks the material to win
+    return material_table::scale(material, total_score);
 }
 
-int debug_node_count = 0;
-
-thc::Move NaiveSerialEngine::solve(thc::ChessRules& cr, bool is_white_player) {
+search_limits::SearchResult NaiveSerialEngine::solve(thc::ChessRules& cr, bool is_white_player,
+                                                     const search_limits::SearchLimits& limits) {
     this->time_limit_reached = false;
     this->start_time = std::chrono::steady_clock::now();
-
-    thc::Move best_move_so_far;
+    this->timer.start(limits, cr.white, DEFAULT_TIME_LIMIT_SECONDS);
+    this->node_limit = limits.nodes;
+    this->nodes_searched = 0;
+    int depth_limit = limits.max_depth(DEFAULT_DEPTH);
+    profile::begin();
+    perf_counters::attach(0);
+    std::vector<perf_counters::Values> search_counters = perf_counters::read();
+
+    search_limits::SearchResult result;
     bool move_found = false;
 
-    for (int current_depth = 1; current_depth <= MAX_DEPTH; ++current_depth) {
-        debug_node_count = 0;
-        if (time_limit_reached) {
+    for (int current_depth = 1; current_depth <= depth_limit; ++current_depth) {
+        stats.clear();
+        // Past the soft limit an iteration would rarely finish in time
+        if (time_limit_reached || !timer.time_for_iteration()) {
             break; 
         }
 
         thc::Move current_best_move;
+        std::vector<perf_counters::Values> iteration_counters = perf_counters::read();
         Score current_score = solve_naive_serial_engine(
             cr,
             is_white_player,
@@ -457,11 +275,17 @@ thc::Move NaiveSerialEngine::solve(thc::ChessRules& cr, bool is_white_player) {
             INF_SCORE
         );
 
+        perf_counters::Values hardware = perf_counters::total(perf_counters::difference(perf_counters::read(), iteration_counters));
+        nodes_searched += stats[search_stats::EVALUATED];
         if (time_limit_reached) {
             break; 
         }
 
-        best_move_so_far = current_best_move;
+        result.best_move = current_best_move;
+        result.score = current_score;
+        result.depth = current_depth;
+        timer.iteration_complete(current_best_move);
+        result.pv.assign(1, current_best_move);
         move_found = true;
 
         // Debug output (record this data as metric for engine performance)
@@ -470,24 +294,52 @@ thc::Move NaiveSerialEngine::solve(thc::ChessRules& cr, bool is_white_player) {
         std::cout << "Depth: " <<  current_depth 
         << ", Score: " << (current_score / 100.0f) 
         << ", Time: " << elapsed_seconds.count() << "s" 
-        << ", Nodes Evaluated = " << debug_node_count 
-        << ", knps: " << (debug_node_count/1000.0) / elapsed_seconds.count() 
+        << ", Nodes Evaluated = " << stats[search_stats::EVALUATED] 
+        << ", knps: " << (stats[search_stats::EVALUATED]/1000.0) / elapsed_seconds.count() 
         << std::endl;
+        if (perf_counters::enabled()) {
+            std::cout << "Hardware: " << perf_counters::describe(hardware, stats[search_stats::EVALUATED]) << std::endl;
+        }
+
+        if (telemetry::enabled()) {
+            telemetry::Iteration record;
+            record.engine = "naive-serial";
+            record.depth = current_depth;
+            record.score = current_score;
+            record.pv = result.pv;
+            record.seconds = elapsed_seconds.count();
+            record.branching_factor = timer.branching_factor();
+            record.counters = stats;
+            record.workers.assign(1, stats[search_stats::EVALUATED]);
+            record.hardware = hardware;
+            telemetry::iteration(record);
+        }
+    }
+
+    profile::report(profile::collect());
+    if (perf_counters::enabled()) {
+        perf_counters::Values hardware = perf_counters::total(perf_counters::difference(perf_counters::read(), search_counters));
+        std::cout << "Hardware, whole search: " << perf_counters::describe(hardware, nodes_searched) << std::endl;
     }
 
-    if (move_found) {
-        return best_move_so_far;
-    } else {
+    if (!move_found) {
         // If no move was found (unlikely), generate a random legal move
         std::vector<thc::Move> legal_moves;
         cr.GenLegalMoveList(legal_moves);
         if (!legal_moves.empty()) {
-            return legal_moves[0];
+            result.best_move = legal_moves[0];
         } else {
             // No legal moves, return a default move
-            return thc::Move();
+            result.best_move = thc::Move();
         }
+        result.pv.assign(1, result.best_move);
     }
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::steady_clock::now() - start_time;
+    result.nodes = nodes_searched;
+    result.workers.assign(1, nodes_searched);
+    result.time = elapsed_seconds.count();
+    return result;
 }
 
 NaiveSerialEngine::Score NaiveSerialEngine::solve_naive_serial_engine(
@@ -497,21 +349,27 @@ NaiveSerialEngine::Score NaiveSerialEngine::solve_naive_serial_engine(
     int depth,
     int max_depth,
     Score alpha_score,
-    Score beta_score
+    Score beta_score,
+    const eval_kernel::BoardSummary* leaf_board
 ) {
+    stats.add(search_stats::NODES);
+    stats.reach(depth);
+
     // Check if time limit has been reached
     if (time_limit_reached) {
         return 0.0f;
     }
 
-    // Check time at certain intervals to minimize performance impact (we do mod 5)
-    if (depth % 5 == 0) { 
-        auto current_time = std::chrono::steady_clock::now();
-        std::chrono::duration<double> elapsed_seconds = current_time - start_time;
-        if (elapsed_seconds.count() >= TIME_LIMIT_SECONDS) {
-            time_limit_reached = true;
-            return 0.0f;
-        }
+    // Check the node limit everywhere, it only costs a comparison
+    if (node_limit > 0 && nodes_searched + stats[search_stats::EVALUATED] >= node_limit) {
+        time_limit_reached = true;
+        return 0.0f;
+    }
+
+    // The time manager reads the clock every few thousand nodes
+    if (timer.poll()) {
+        time_limit_reached = true;
+        return 0.0f;
     }
 
     thc::DRAWTYPE draw_reason;
@@ -523,20 +381,20 @@ NaiveSerialEngine::Score NaiveSerialEngine::solve_naive_serial_engine(
     thc::TERMINAL terminal;
     if (cr.Evaluate(terminal)) {
         if (terminal == thc::TERMINAL_WCHECKMATE) {
-            debug_node_count++;
+            stats.add(search_stats::EVALUATED);
             return -INF_SCORE + depth; // White is checkmated
         } else if (terminal == thc::TERMINAL_BCHECKMATE) {
-            debug_node_count++;
+            stats.add(search_stats::EVALUATED);
             return INF_SCORE - depth; // Black is checkmated
         } else if (terminal == thc::TERMINAL_WSTALEMATE || terminal == thc::TERMINAL_BSTALEMATE) {
-            debug_node_count++;
+            stats.add(search_stats::EVALUATED);
             return 0.0f; // Stalemate is a draw
         }
     }
 
     if (depth == max_depth) {
-        debug_node_count++;
-        return static_eval(cr);
+        stats.add(search_stats::EVALUATED);
+        return leaf_board ? static_eval(cr, *leaf_board) : static_eval(cr);
     }
 
     std::vector<thc::Move> legal_moves;
@@ -549,6 +407,16 @@ NaiveSerialEngine::Score NaiveSerialEngine::solve_naive_serial_engine(
 
     Score best_score = is_white_player ? -INF_SCORE : INF_SCORE;
 
+    // A ply above the leaves every child is a leaf, and all of them are searched, so their summaries are made
+    // together from this node's, a batch at a time (see eval-kernel.h)
+    std::vector<eval_kernel::BoardSummary> leaves;
+    if (depth == max_depth - 1) {
+        eval_kernel::BoardSummary board;
+        eval_kernel::summarise(cr.squares, board);
+        leaves.resize(legal_moves.size());
+        eval_kernel::summarise_children(cr.squares, board, legal_moves.data(), legal_moves.size(), leaves.data());
+    }
+
     for (size_t i = 0; i < legal_moves.size(); i++) {
         auto& move = legal_moves[i]; // Ensure 'move' is non-const
 
@@ -564,7 +432,8 @@ NaiveSerialEngine::Score NaiveSerialEngine::solve_naive_serial_engine(
             depth + 1,
             max_depth,
             alpha_score,
-            beta_score
+            beta_score,
+            leaves.empty() ? nullptr : &leaves[i]
         );
 
         // Pop the move
@@ -2,6 +2,15 @@
 #define NAIVE_SERIAL_ENGINE_H
 
 #include "thc.h"      // Include the THC library header
+#include "search-limits.h"
+#include "time-manager.h"
+#include "eval-kernel.h"
+#include "material-table.h"
+#include "endgame.h"
+#include "search-stats.h"
+#include "telemetry.h"
+#include "profile.h"
+#include "perf-counters.h"
 #include <chrono>
 #include <atomic>
 #include <vector>     // For std::vector
@@ -11,11 +20,17 @@ public:
     using Score = float;
 
     static constexpr Score INF_SCORE = 1000000.0f;
-    static constexpr int MAX_DEPTH = 5;
-    static constexpr int TIME_LIMIT_SECONDS = 60; // Time limit in seconds
+    static constexpr int DEFAULT_DEPTH = 5; // searched when the limits set no depth
+    static constexpr int DEFAULT_TIME_LIMIT_SECONDS = 60; // Time limit in seconds, when the limits set none
 
-    // Solve function to find the best move
-    thc::Move solve(thc::ChessRules& cr, bool is_white_player);
+    // Solve function to find the best move within the given limits, with its score and principal variation
+    search_limits::SearchResult solve(thc::ChessRules& cr, bool is_white_player,
+                                      const search_limits::SearchLimits& limits);
+
+    // Solve function to find the best move, at the default depth and time limit
+    thc::Move solve(thc::ChessRules& cr, bool is_white_player) {
+        return solve(cr, is_white_player, search_limits::SearchLimits()).best_move;
+    }
 
 private:
     // Recursive search function with alpha-beta pruning and iterative deepening
@@ -26,11 +41,13 @@ private:
         int depth,
         int max_depth,
         Score alpha_score,
-        Score beta_score
+        Score beta_score,
+        const eval_kernel::BoardSummary* leaf_board = nullptr   // the node's summary, when it is a leaf
     );
 
     // Static evaluation function
     Score static_eval(thc::ChessRules& cr);
+    Score static_eval(thc::ChessRules& cr, const eval_kernel::BoardSummary& board);
 
     // Helper function to score moves for move ordering
     float score_move(const thc::Move& move, thc::ChessRules& cr);
@@ -38,23 +55,26 @@ private:
     // **Add the missing function declarations here**
 
     // Function to evaluate mobility
-    int evaluate_mobility(thc::ChessRules& cr, bool is_white, const std::vector<int>& piece_indices);
+    int evaluate_mobility(thc::ChessRules& cr, bool is_white);
 
     // Function to evaluate pawn structure
-    int evaluate_pawn_structure(const std::vector<int>& pawn_files, bool is_white);
+    int evaluate_pawn_structure(uint64_t pawns, bool is_white);
 
     // Function to evaluate king safety
     int evaluate_king_safety(thc::ChessRules& cr, int king_index, bool is_white, bool endgame);
 
-    // Function to detect endgame phase
-    bool is_endgame(int white_material, int black_material);
-
     // Function to evaluate king activity in endgame
     int evaluate_king_activity(int own_king_index, int opponent_king_index, bool is_white);
 
+    // What the iteration under way has searched
+    search_stats::Counters stats;
+
     // Time management variables
     std::chrono::steady_clock::time_point start_time;
     std::atomic<bool> time_limit_reached;
+    time_manager::TimeManager timer;
+    uint64_t node_limit;        // 0 for none
+    uint64_t nodes_searched;    // in the iterations completed so far
 };
 
 #endif 
@@ -0,0 +1,88 @@
+/*
+ *  search-limits
+ *
+ *  See search-limits.h.
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include "search-limits.h"
+
+namespace search_limits {
+
+namespace {
+
+bool parse_int(const char* text, int64_t& value) {
+    char* end;
+    long long parsed = std::strtoll(text, &end, 10);
+    if (end == text || *end != '\0' || parsed < 0) {
+        return false;
+    }
+    value = parsed;
+    return true;
+}
+
+} // namespace
+
+int SearchLimits::max_depth(int default_depth) const {
+    if (depth > 0) {
+        return std::min(depth, MAX_SEARCH_DEPTH);
+    }
+    if (mate > 0) {
+        return std::min(2 * mate - 1, MAX_SEARCH_DEPTH);
+    }
+    if (infinite || nodes > 0 || movetime > 0 || on_clock()) {
+        return MAX_SEARCH_DEPTH;
+    }
+    return default_depth;
+}
+
+void SearchLimits::spend(bool white, int64_t elapsed_ms) {
+    if (!on_clock()) {
+        return;
+    }
+    int64_t& left = white ? wtime : btime;
+    left = std::max<int64_t>(left - elapsed_ms, 0) + (white ? winc : binc);
+}
+
+bool parse_flag(int argc, char* argv[], int& i, SearchLimits& limits) {
+    const char* flag = argv[i];
+    if (std::strcmp(flag, "--infinite") == 0) {
+        limits.infinite = true;
+        return true;
+    }
+
+    int64_t value;
+    if (i + 1 >= argc || !parse_int(argv[i + 1], value)) {
+        return false;
+    }
+    if (std::strcmp(flag, "--depth") == 0) {
+        limits.depth = (int)std::min<int64_t>(value, MAX_SEARCH_DEPTH);
+    } else if (std::strcmp(flag, "--nodes") == 0) {
+        limits.nodes = value;
+    } else if (std::strcmp(flag, "--movetime") == 0) {
+        limits.movetime = value;
+    } else if (std::strcmp(flag, "--wtime") == 0) {
+        limits.wtime = value;
+    } else if (std::strcmp(flag, "--btime") == 0) {
+        limits.btime = value;
+    } else if (std::strcmp(flag, "--winc") == 0) {
+        limits.winc = value;
+    } else if (std::strcmp(flag, "--binc") == 0) {
+        limits.binc = value;
+    } else if (std::strcmp(flag, "--mate") == 0) {
+        limits.mate = (int)std::min<int64_t>(value, MAX_SEARCH_DEPTH);
+    } else {
+        return false;
+    }
+    i++;
+    return true;
+}
+
+const char* usage() {
+    return "[--depth PLIES] [--nodes N] [--movetime MS] [--wtime MS] [--btime MS] [--winc MS] [--binc MS] "
+           "[--mate MOVES] [--infinite]";
+}
+
+} // namespace search_limits
@@ -0,0 +1,61 @@
+#ifndef TELEMETRY_H
+#define TELEMETRY_H
+
+/*
+ *  telemetry
+ *
+ *  Machine-readable search metrics, next to the human-readable line solve() prints to std::cout. Once open()
+ *  has been given somewhere to write, every completed iteration of iterative deepening is written there as one
+ *  line of JSON (JSON lines), flushed at once so a reader can follow the file while the engine plays:
+ *
+ *      {"type":"iteration","engine":"omp","depth":7,"seldepth":15,"score_cp":24,"pv":["e2e4","e7e5"],
+ *       "nodes":85432,"search_nodes":30021,"qnodes":80112,"nps":412000,"time_ms":207.4,"ebf":3.1,
+ *       "first_move_cutoff_pct":93.2,"tablebase_hit_pct":0.0,"workers":[42001,43431]}
+ *
+ *  nodes are the positions evaluated (the count the node limit and the debug line use), search_nodes and qnodes
+ *  the nodes of the main and quiescence searches, score_cp is white minus black, and workers has the nodes of
+ *  each thread (OpenMP) or rank (MPI). The engines have no transposition table; the hit rate reported is that of
+ *  the endgame tablebases and the KPK bitbase.
+ *
+ *  With the hardware counters on (see perf-counters.h), a record also has "hw": the counts of the iteration over
+ *  every thread, such as {"cycles":512000000,"instructions":1230000000,"cpu_ms":207.1}, for the events counted.
+ */
+
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "search-stats.h"
+#include "perf-counters.h"
+#include "thc.h"
+
+namespace telemetry {
+
+// What an iteration reports
+struct Iteration {
+    const char* engine = "";
+    int depth = 0;
+    float score = 0.0f;                 // centipawns, white minus black
+    std::vector<thc::Move> pv;
+    double seconds = 0.0;               // since the search started
+    double branching_factor = 0.0;      // 0 until the time manager has measured one
+    search_stats::Counters counters;    // of every thread or rank together
+    std::vector<uint64_t> workers;      // positions evaluated by each thread or rank
+    perf_counters::Values hardware{};   // counted by every thread or rank, if perf_counters::enabled()
+};
+
+// Write the telemetry to target: a file path (truncated), "-" for standard output, or "fd:N" for a file
+// descriptor the caller has opened. False if it cannot be opened.
+bool open(const std::string& target);
+
+// Whether open() has succeeded
+bool enabled();
+
+// Write one iteration, if enabled
+void iteration(const Iteration& record);
+
+// Flag for the engines' command lines
+const char* usage();
+
+} // namespace telemetry
+
+#endif // TELEMETRY_H
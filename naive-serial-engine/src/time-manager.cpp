@@ -0,0 +1,141 @@
+/*
+ *  time-manager
+ *
+ *  See time-manager.h.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include "time-manager.h"
+
+namespace time_manager {
+
+void TimeManager::start(const search_limits::SearchLimits& limits, bool white, double default_seconds) {
+    start_time = std::chrono::steady_clock::now();
+    expired.store(false, std::memory_order_relaxed);
+    have_best_move = false;
+    stable_iterations = 0;
+    changes = 0.0;
+    last_iteration_end = start_time;
+    last_iteration_seconds = 0.0;
+    last_ratio = 0.0;
+    ebf = 0.0;
+    allocate(limits, white, default_seconds);
+}
+
+void TimeManager::ponder_hit(const search_limits::SearchLimits& limits, bool white, double default_seconds) {
+    start_time = std::chrono::steady_clock::now();
+    allocate(limits, white, default_seconds);
+}
+
+void TimeManager::allocate(const search_limits::SearchLimits& limits, bool white, double default_seconds) {
+    double soft = 0.0;
+    double hard = 0.0;
+    bool on_clock = false;
+    if (limits.infinite) {
+        soft = hard = 0.0;
+    } else if (limits.movetime > 0) {
+        soft = hard = limits.movetime / 1000.0;
+    } else if (limits.on_clock()) {
+        int64_t left = white ? limits.wtime : limits.btime;
+        int64_t increment = white ? limits.winc : limits.binc;
+        int64_t usable = std::max<int64_t>(left - CLOCK_MARGIN_MS, 1);
+
+        int64_t optimum = left / MOVES_TO_GO + (int64_t)(increment * INCREMENT_SHARE);
+        int64_t maximum = std::min((int64_t)(optimum * MAX_STRETCH), left / MAX_SHARE_DIVISOR + increment);
+        optimum = std::clamp<int64_t>(optimum, 1, usable);
+        maximum = std::clamp<int64_t>(maximum, optimum, usable);
+
+        soft = optimum / 1000.0;
+        hard = maximum / 1000.0;
+        on_clock = true;
+    } else if (limits.depth > 0 || limits.nodes > 0 || limits.mate > 0) {
+        soft = hard = 0.0;
+    } else {
+        soft = hard = default_seconds;
+    }
+    optimum_seconds = soft;
+    soft_seconds = soft;
+    hard_seconds = hard;
+    adaptive = on_clock;
+}
+
+double TimeManager::elapsed() const {
+    std::chrono::duration<double> elapsed_seconds = std::chrono::steady_clock::now() - start_time.load();
+    return elapsed_seconds.count();
+}
+
+bool TimeManager::poll(uint32_t interval) {
+    if (stopped.load(std::memory_order_relaxed)) {
+        return true;
+    }
+    if (hard_seconds <= 0) {
+        return false;
+    }
+    if (expired.load(std::memory_order_relaxed)) {
+        return true;
+    }
+
+    // Counted per thread so the parallel searches need no shared counter
+    thread_local uint32_t calls = 0;
+    if (++calls % interval != 0) {
+        return false;
+    }
+    if (elapsed() >= hard_seconds) {
+        expired.store(true, std::memory_order_relaxed);
+        return true;
+    }
+    return false;
+}
+
+void TimeManager::iteration_complete(const thc::Move& best_move) {
+    // Iterations alternate between cheap and expensive ones (odd and even depths end on different sides), so
+    // the branching factor is the geometric mean of the last two ratios
+    auto now = std::chrono::steady_clock::now();
+    double seconds = std::chrono::duration<double>(now - last_iteration_end).count();
+    double ratio = 0.0;
+    if (last_iteration_seconds >= MIN_MEASURED_SECONDS) {
+        ratio = std::clamp(seconds / last_iteration_seconds, 1.0, MAX_BRANCHING_FACTOR);
+        ebf = last_ratio > 0 ? std::sqrt(ratio * last_ratio) : ratio;
+    }
+    last_ratio = ratio;
+    last_iteration_seconds = seconds;
+    last_iteration_end = now;
+
+    changes /= 2;
+    if (have_best_move && best_move == last_best_move) {
+        stable_iterations++;
+    } else {
+        if (have_best_move) {
+            changes += 1.0;
+        }
+        stable_iterations = 0;
+    }
+    last_best_move = best_move;
+    have_best_move = true;
+
+    if (!adaptive) {
+        return;
+    }
+    double scale = 1.0 + CHANGE_WEIGHT * changes;
+    if (stable_iterations >= STABLE_ITERATIONS) {
+        scale *= STABLE_SCALE;
+    }
+    soft_seconds = std::min<double>(optimum_seconds * scale, hard_seconds);
+}
+
+bool TimeManager::time_for_iteration() const {
+    if (expired.load(std::memory_order_relaxed) || stopped.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    if (soft_seconds <= 0) {
+        return true;
+    }
+    double now = elapsed();
+    if (now >= soft_seconds) {
+        return false;
+    }
+    return ebf == 0 || now + last_iteration_seconds * ebf < hard_seconds;
+}
+
+} // namespace time_manager
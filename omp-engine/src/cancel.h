@@ -0,0 +1,43 @@
+#ifndef CANCEL_H
+#define CANCEL_H
+
+/*
+ *  cancel
+ *
+ *  Cooperative cancellation for the parallel search. Every node of solve_omp_engine has a Flag linked to the
+ *  Flag of the node above it, so the flags of the nodes being searched form a tree the same shape as the search.
+ *  A node raises its flag when it fails high: its remaining moves, including the ones other threads are already
+ *  searching, can no longer change its result. Each node polls its own chain of flags before every move and on
+ *  return from every child, so a cutoff anywhere reaches all the subtrees below it, on every thread, within a
+ *  node or so of their work.
+ *
+ *  Polling walks up to the root, which costs one relaxed load per ply of the path, all of them flags the thread
+ *  has touched recently. Raising is a single store and never has to find the descendants.
+ */
+
+#include <atomic>
+
+namespace cancel {
+
+struct Flag {
+    std::atomic<bool> raised{false};
+    const Flag* parent;
+
+    explicit Flag(const Flag* parent = nullptr) : parent(parent) {}
+
+    void raise() { raised.store(true, std::memory_order_relaxed); }
+
+    // Whether this node or any node above it has been cancelled
+    bool cancelled() const {
+        for (const Flag* flag = this; flag; flag = flag->parent) {
+            if (flag->raised.load(std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+};
+
+} // namespace cancel
+
+#endif // CANCEL_H
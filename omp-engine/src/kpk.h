@@ -0,0 +1,27 @@
+#ifndef KPK_H
+#define KPK_H
+
+/*
+ *  kpk
+ *
+ *  Exact win/draw results for king + pawn vs king, from a bitbase generated at build time by kpk-gen (see
+ *  kpk-gen.cpp). One bit per position, set when the side with the pawn wins, 24 KB in all.
+ */
+
+namespace kpk {
+
+// Positions in the bitbase: side to move x pawn on files a-d, ranks 2-7 x white king x black king
+constexpr int POSITIONS = 2 * 24 * 64 * 64;
+
+// Bitbase index of a normalised position: white has the pawn, on files a-d. Squares as in thc (a8 = 0).
+constexpr int index(bool white_to_move, int white_king, int black_king, int pawn) {
+    return white_king | (black_king << 6) | (white_to_move ? 0 : 1 << 12)
+         | ((pawn % 8) << 13) | ((pawn / 8 - 1) << 15);
+}
+
+// Whether the side with the pawn wins. Any colour and file, squares as in thc (a8 = 0).
+bool probe(bool strong_white, bool strong_to_move, int strong_king, int pawn, int weak_king);
+
+} // namespace kpk
+
+#endif // KPK_H
@@ -0,0 +1,70 @@
+#ifndef MATERIAL_TABLE_H
+#define MATERIAL_TABLE_H
+
+/*
+ *  material-table
+ *
+ *  Everything static_eval wants to know about the material on the board, looked up once per node from the
+ *  material signature thc::ChessRules keeps up to date (see MATERIAL_FIELD in thc.h) instead of being worked
+ *  out from a board scan.
+ *
+ *  The table covers every signature with up to 8 pawns, 2 knights, 2 bishops, 2 rooks and 1 queen per side
+ *  (486 x 486 entries). Signatures outside that range only arise after under/extra promotions and are
+ *  classified on the fly, with the same result a table entry would hold.
+ */
+
+#include <cstdint>
+#include "thc.h"
+
+namespace material_table {
+
+// Entry flags
+enum Flags : uint8_t {
+    ENDGAME       = 1,    // total non-king material at or below the endgame threshold
+    WHITE_NO_WIN  = 2,    // white does not have the material to force mate
+    BLACK_NO_WIN  = 4,
+};
+
+// Specialised endgames, recognised by signature so an evaluator can be dispatched without looking at the board
+enum EndgameType : uint8_t {
+    ENDGAME_NONE = 0,
+    ENDGAME_KPK,          // king and pawn vs king
+    ENDGAME_KQK,          // king and queen vs king
+    ENDGAME_KRK,          // king and rook vs king
+    ENDGAME_KBNK,         // king, bishop and knight vs king
+    ENDGAME_KRKP,         // king and rook vs king and pawn
+};
+
+// Full scale, scores are multiplied by scale / SCALE_NORMAL
+constexpr int SCALE_NORMAL = 64;
+
+struct Entry {
+    uint8_t flags;
+    uint8_t white_scale;    // applied to scores in white's favour
+    uint8_t black_scale;    // applied to scores in black's favour
+    EndgameType endgame;
+    bool strong_white;      // for endgame != ENDGAME_NONE, whether white is the side with the extra material
+};
+
+// Classify a signature from scratch (what the table is built from)
+Entry classify(uint64_t key);
+
+// Look a signature up
+Entry probe(uint64_t key);
+
+// Scale a white-minus-black score by the entry's scale for the side it favours
+inline float scale(const Entry& entry, float score) {
+    int factor = score > 0 ? entry.white_scale : entry.black_scale;
+    return factor == SCALE_NORMAL ? score : score * factor / SCALE_NORMAL;
+}
+
+// Whether a side has any piece besides its king and pawns
+inline bool has_pieces(uint64_t key, bool white) {
+    uint64_t pieces = white ? MATERIAL_WHITE_MASK & ~(0xfULL << thc::MATERIAL_WP)
+                            : MATERIAL_BLACK_MASK & ~(0xfULL << thc::MATERIAL_BP);
+    return (key & pieces) != 0;
+}
+
+} // namespace material_table
+
+#endif // MATERIAL_TABLE_H
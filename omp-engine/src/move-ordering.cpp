@@ -0,0 +1,85 @@
+/*
+ *  move-ordering
+ *
+ *  See move-ordering.h. History scores are updated with the usual saturating rule,
+ *  h += bonus - h * bonus / MAX_HISTORY, so they never overflow however long the search runs and recent cutoffs
+ *  weigh more than old ones.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include "move-ordering.h"
+
+namespace move_ordering {
+
+void Tables::clear() {
+    for (int ply = 0; ply < MAX_PLY; ply++) {
+        killers[ply][0].Invalid();
+        killers[ply][1].Invalid();
+        played[ply].Invalid();
+        pv_length[ply] = 0;
+    }
+    for (int from = 0; from < 64; from++) {
+        for (int to = 0; to < 64; to++) {
+            countermoves[from][to].Invalid();
+        }
+    }
+    std::memset(history, 0, sizeof(history));
+    nodes = 0;
+}
+
+void Tables::update_pv(const thc::Move& move, int ply) {
+    if (ply >= MAX_PLY) {
+        return;
+    }
+    pv[ply][0] = move;
+    int length = ply + 1 < MAX_PLY ? std::min(pv_length[ply + 1], MAX_PLY - 1) : 0;
+    for (int i = 0; i < length; i++) {
+        pv[ply][i + 1] = pv[ply + 1][i];
+    }
+    pv_length[ply] = length + 1;
+}
+
+thc::Move Tables::previous(int ply) const {
+    thc::Move move;
+    if (ply > 0 && ply <= MAX_PLY) {
+        move = played[ply - 1];
+    } else {
+        move.Invalid();
+    }
+    return move;
+}
+
+float Tables::quiet_bonus(const thc::Move& move, int ply, bool white) const {
+    if (ply < MAX_PLY) {
+        if (move == killers[ply][0]) return KILLER_BONUS[0];
+        if (move == killers[ply][1]) return KILLER_BONUS[1];
+    }
+    thc::Move last = previous(ply);
+    if (last.Valid() && move == countermoves[last.src][last.dst]) {
+        return COUNTERMOVE_BONUS;
+    }
+    return HISTORY_WEIGHT * history[white][move.src][move.dst] / MAX_HISTORY;
+}
+
+void Tables::update_cutoff(const thc::Move& move, int ply, bool white, int depth) {
+    if (!is_quiet(move)) {
+        return;
+    }
+
+    if (ply < MAX_PLY && move != killers[ply][0]) {
+        killers[ply][1] = killers[ply][0];
+        killers[ply][0] = move;
+    }
+
+    int& h = history[white][move.src][move.dst];
+    int bonus = std::min(depth * depth, MAX_HISTORY);
+    h += bonus - h * bonus / MAX_HISTORY;
+
+    thc::Move last = previous(ply);
+    if (last.Valid()) {
+        countermoves[last.src][last.dst] = move;
+    }
+}
+
+} // namespace move_ordering
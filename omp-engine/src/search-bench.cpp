@@ -0,0 +1,52 @@
+/* search-bench.cpp
+ *
+ *  Fixed-depth search of the positions in bench-positions.h, for scaling-bench.sh. Prints one CSV line per
+ *  position (the engine's own search output is kept off standard output):
+ *
+ *      engine,workers,position,depth,seconds,nodes,worker_nodes
+ *
+ *  where worker_nodes has the nodes of each thread, separated by spaces. Build with "make search-bench", run with
+ *  ./search-bench [depth] [threads].
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <omp.h>
+#include "thc.h"
+#include "bench-positions.h"
+#include "omp-engine.h"
+
+int main(int argc, char* argv[]) {
+    int depth = argc > 1 ? std::atoi(argv[1]) : 7;
+    int threads = argc > 2 ? std::atoi(argv[2]) : omp_get_max_threads();
+    if (depth < 1 || depth > search_limits::MAX_SEARCH_DEPTH || threads < 1) {
+        std::fprintf(stderr, "Usage: %s [depth] [threads]\n", argv[0]);
+        return 1;
+    }
+    omp_set_num_threads(threads);
+
+    OMPEngine engine;
+    search_limits::SearchLimits limits;
+    limits.depth = depth;
+
+    for (int position = 0; position < bench_positions::COUNT; position++) {
+        thc::ChessRules cr;
+        cr.Forsyth(bench_positions::FENS[position]);
+
+        std::streambuf* output = std::cout.rdbuf(nullptr);
+        search_limits::SearchResult result = engine.solve(cr, cr.WhiteToPlay(), limits);
+        std::cout.rdbuf(output);
+        std::cout.clear();
+
+        std::string worker_nodes;
+        for (uint64_t nodes : result.workers) {
+            worker_nodes += (worker_nodes.empty() ? "" : " ") + std::to_string(nodes);
+        }
+        std::printf("omp,%d,%d,%d,%.6f,%llu,%s\n", threads, position, result.depth, result.time,
+                    (unsigned long long)result.nodes, worker_nodes.c_str());
+        std::fflush(stdout);
+    }
+    return 0;
+}
@@ -0,0 +1,117 @@
+#ifndef SEARCH_THREAD_H
+#define SEARCH_THREAD_H
+
+/*
+ *  search-thread
+ *
+ *  Runs an engine's solve() on a thread of its own, so main.cpp can wait for the player's move while the engine
+ *  thinks. The engine has to offer stop(), clear_stop() and ponder_hit() (they go to its time manager).
+ *
+ *  Pondering: after playing a move the engine searches the position after the reply its principal variation
+ *  expects, with no time limit, while the opponent thinks. If the opponent plays that reply (a ponder hit) the
+ *  search keeps everything it has done and only now starts counting its time; any other reply stops it, and the
+ *  real position is searched from scratch.
+ */
+
+#include <algorithm>
+#include <functional>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "search-limits.h"
+#include "thc.h"
+
+namespace search_thread {
+
+template <typename Engine>
+class SearchThread {
+public:
+    // thread_setup, if given, runs on the search thread before every search (per-thread settings such as the
+    // OpenMP thread count)
+    explicit SearchThread(Engine& engine, std::function<void()> thread_setup = nullptr)
+        : engine(engine), thread_setup(std::move(thread_setup)) {}
+
+    ~SearchThread() { stop(); }
+
+    SearchThread(const SearchThread&) = delete;
+    SearchThread& operator=(const SearchThread&) = delete;
+
+    // Search cr for the side is_white_player in the background
+    void start(const thc::ChessRules& cr, bool is_white_player, const search_limits::SearchLimits& limits) {
+        stop();
+        engine.clear_stop();
+        position = cr;
+        pondering = false;
+        worker = std::thread([this, is_white_player, limits] {
+            if (thread_setup) {
+                thread_setup();
+            }
+            result = engine.solve(position, is_white_player, limits);
+        });
+    }
+
+    // Wait for the search to finish by itself
+    search_limits::SearchResult wait() {
+        if (worker.joinable()) {
+            worker.join();
+        }
+        return result;
+    }
+
+    // Stop the search, if any, and wait for it
+    search_limits::SearchResult stop() {
+        if (worker.joinable()) {
+            engine.stop();
+        }
+        pondering = false;
+        return wait();
+    }
+
+    // Ponder after the engine has played from cr: search the position after expected_reply, for the side
+    // is_white_player, until the opponent moves. The search keeps to the depth it would search anyway, but has no
+    // time limit until ponder_hit().
+    void ponder(const thc::ChessRules& cr, thc::Move expected_reply, bool is_white_player,
+                search_limits::SearchLimits limits) {
+        thc::ChessRules after_reply = cr;
+        std::vector<thc::Move> legal_moves;
+        after_reply.GenLegalMoveList(legal_moves);
+        if (std::find(legal_moves.begin(), legal_moves.end(), expected_reply) == legal_moves.end()) {
+            return;
+        }
+        after_reply.PushMove(expected_reply);
+        limits.depth = limits.max_depth(Engine::DEFAULT_DEPTH);
+        limits.infinite = true;
+        start(after_reply, is_white_player, limits);
+        pondering = true;
+    }
+
+    // The engine is to move in cr. On a ponder hit (cr is the position being pondered) the search goes on with
+    // the time limits for cr and true is returned; otherwise any ponder search is stopped and thrown away.
+    bool ponder_hit(const thc::ChessRules& cr, const search_limits::SearchLimits& limits) {
+        if (!pondering) {
+            return false;
+        }
+        pondering = false;
+        if (cr == position) {
+            engine.ponder_hit(limits, cr.white);
+            return true;
+        }
+        stop();
+        return false;
+    }
+
+private:
+    Engine& engine;
+    std::function<void()> thread_setup;
+    std::thread worker;
+
+    // Owned by the search thread while it runs
+    thc::ChessRules position;
+    search_limits::SearchResult result;
+
+    bool pondering = false;
+};
+
+} // namespace search_thread
+
+#endif // SEARCH_THREAD_H
@@ -0,0 +1,37 @@
+#ifndef SEE_H
+#define SEE_H
+
+/*
+ *  see
+ *
+ *  Static exchange evaluation: the material a capture wins or loses once every piece that attacks or defends
+ *  the target square has had its say, each side recapturing with its least valuable piece and free to stop when
+ *  going on would cost it. Pieces lined up behind each other (a queen behind a rook, say) join in as the ones in
+ *  front are exchanged off. Pins and checks are ignored.
+ *
+ *  QxP with the pawn defended by a pawn comes out at PAWN_VALUE - QUEEN_VALUE, where the victim value alone
+ *  would rank it with PxP. Attackers are found with thc's attack lookup tables.
+ */
+
+#include "thc.h"
+
+namespace see {
+
+// Ordering class of a capture or promotion
+enum Exchange {
+    BAD,        // loses material
+    EQUAL,      // wins back what it gives
+    GOOD        // wins material
+};
+
+// Net material (centipawns, for the side making the move) of the exchange move starts on its destination square.
+// Quiet moves are scored too: a negative result means the piece can be taken for less than it is worth.
+int evaluate(const thc::ChessRules& cr, const thc::Move& move);
+
+inline Exchange classify(int exchange) {
+    return exchange > 0 ? GOOD : exchange == 0 ? EQUAL : BAD;
+}
+
+} // namespace see
+
+#endif // SEE_H
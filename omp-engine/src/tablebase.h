@@ -0,0 +1,96 @@
+#ifndef TABLEBASE_H
+#define TABLEBASE_H
+
+/*
+ *  tablebase
+ *
+ *  Endgame tablebases for up to MAX_PIECES pieces (kings included), as written by tablebase-generator. Each
+ *  material combination is one pair of files, named after it with the stronger side first:
+ *
+ *      KQvKR.wdl   2 bits per position: draw, win, loss (for the side to move) or no such position
+ *      KQvKR.dtm   1 byte per position: moves until mate, for the side winning or for the side being mated
+ *
+ *  both starting with a FileHeader. The engines map the files into memory with init() and look positions up
+ *  with probe(), which flips colours as needed so KRvKQ is answered from KQvKR.
+ *
+ *  Positions are numbered by the squares of the pieces in a fixed order (white king, black king, white pieces,
+ *  black pieces, each side Q R B N P). The white king is brought into a canonical area by symmetry first:
+ *  files a-d when there are pawns, the a1-d1-d4 triangle when there are none. A position can still have several
+ *  numbers (like pieces swapped, or a king on the a1-d4 diagonal with the board mirrored in it); index() always
+ *  gives the lowest, and the others hold the same value. Tables do not record castling rights or en passant, so
+ *  positions with either are not probed.
+ */
+
+#include <cstdint>
+#include <string>
+#include "thc.h"
+
+namespace tablebase {
+
+constexpr int MAX_PIECES = 5;
+
+enum Wdl : int8_t {
+    LOSS = -1,
+    DRAW = 0,
+    WIN  = 1
+};
+
+// Codes stored in the .wdl files
+enum WdlCode : uint8_t {
+    CODE_DRAW    = 0,
+    CODE_WIN     = 1,
+    CODE_LOSS    = 2,
+    CODE_INVALID = 3
+};
+
+struct FileHeader {
+    char magic[8];          // "THCTBW1" or "THCTBD1"
+    uint64_t key;           // thc material signature of the table
+    uint64_t positions;     // positions per side to move
+    uint32_t pieces;
+    uint32_t reserved;
+};
+
+constexpr char WDL_MAGIC[8] = "THCTBW1";
+constexpr char DTM_MAGIC[8] = "THCTBD1";
+
+// How the positions of one material combination are laid out
+struct Layout {
+    uint64_t key;
+    int count;                  // pieces, kings included
+    char pieces[MAX_PIECES];    // 'K', 'k', then white then black pieces
+    bool pawns;
+    uint64_t positions;         // per side to move
+};
+
+// Material signature helpers
+uint64_t swap_colours(uint64_t key);
+bool is_canonical(uint64_t key);        // stored as is (otherwise with colours swapped)
+int piece_count(uint64_t key);          // kings included
+std::string name(uint64_t key);         // e.g. "KQvKR"
+
+Layout layout(uint64_t key);            // key must be canonical and have at most MAX_PIECES pieces
+
+// Position number of cr (0 .. 2 * positions - 1). With flip the position is first mirrored with colours swapped,
+// which is how a non-canonical material is found in its table.
+uint64_t index(const Layout& layout, const thc::ChessRules& cr, bool flip);
+
+// Set cr up from a position number. Returns false when two pieces share a square; legality is not checked.
+bool decode(const Layout& layout, uint64_t index, thc::ChessRules& cr);
+
+// Map every table found in a directory, returns how many were loaded
+int init(const std::string& directory);
+
+// Map one table given the path of its .wdl file (the .dtm next to it is optional)
+bool load(const std::string& wdl_path);
+
+// Largest piece count with a table loaded, 0 if none
+int max_pieces();
+
+// Look a position up. Returns false if there is no table for it. When the table has distances to mate, plies is
+// set to the number of half moves to mate (from the position, for either side), otherwise to -1.
+bool probe(const thc::ChessRules& cr, Wdl& wdl, int& plies);
+
+} // namespace tablebase
+
+#endif // TABLEBASE_H
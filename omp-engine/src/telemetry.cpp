@@ -0,0 +1,151 @@
+/*
+ *  telemetry
+ *
+ *  See telemetry.h.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include "telemetry.h"
+
+namespace telemetry {
+
+namespace {
+
+FILE* stream = nullptr;
+
+// A double as JSON, which has no infinities or NaNs
+void write_number(std::string& line, double value) {
+    char buffer[32];
+    if (!(value > -1e300 && value < 1e300)) {
+        value = 0.0;
+    }
+    std::snprintf(buffer, sizeof(buffer), "%.6g", value);
+    line += buffer;
+}
+
+void write_field(std::string& line, const char* name) {
+    line += ",\"";
+    line += name;
+    line += "\":";
+}
+
+} // namespace
+
+bool open(const std::string& target) {
+    FILE* opened = nullptr;
+    if (target == "-") {
+        opened = stdout;
+    } else if (target.compare(0, 3, "fd:") == 0) {
+        char* end;
+        long fd = std::strtol(target.c_str() + 3, &end, 10);
+        if (end != target.c_str() + 3 && *end == '\0' && fd >= 0) {
+            opened = fdopen((int)fd, "w");
+        }
+    } else {
+        opened = std::fopen(target.c_str(), "w");
+    }
+    if (!opened) {
+        return false;
+    }
+    if (stream && stream != stdout) {
+        std::fclose(stream);
+    }
+    stream = opened;
+    return true;
+}
+
+bool enabled() {
+    return stream != nullptr;
+}
+
+void iteration(const Iteration& record) {
+    if (!stream) {
+        return;
+    }
+    const search_stats::Counters& counters = record.counters;
+    uint64_t nodes = counters[search_stats::EVALUATED];
+    uint64_t cutoffs = counters[search_stats::CUTOFFS];
+
+    std::string line = "{\"type\":\"iteration\",\"engine\":\"";
+    line += record.engine;
+    line += "\"";
+    write_field(line, "depth");
+    line += std::to_string(record.depth);
+    write_field(line, "seldepth");
+    line += std::to_string(std::max(counters.seldepth(), record.depth));
+    write_field(line, "score_cp");
+    write_number(line, record.score);
+
+    write_field(line, "pv");
+    line += "[";
+    for (size_t i = 0; i < record.pv.size(); i++) {
+        thc::Move move = record.pv[i];
+        line += i ? ",\"" : "\"";
+        line += move.TerseOut();
+        line += "\"";
+    }
+    line += "]";
+
+    write_field(line, "nodes");
+    line += std::to_string(nodes);
+    write_field(line, "search_nodes");
+    line += std::to_string(counters[search_stats::NODES]);
+    write_field(line, "qnodes");
+    line += std::to_string(counters[search_stats::QNODES]);
+    write_field(line, "nps");
+    line += std::to_string(record.seconds > 0 ? (uint64_t)(nodes / record.seconds) : 0);
+    write_field(line, "time_ms");
+    write_number(line, record.seconds * 1000.0);
+    write_field(line, "ebf");
+    write_number(line, record.branching_factor);
+    write_field(line, "first_move_cutoff_pct");
+    write_number(line, cutoffs ? 100.0 * counters[search_stats::FIRST_MOVE_CUTOFFS] / cutoffs : 0.0);
+    write_field(line, "tablebase_hit_pct");
+    write_number(line, nodes ? 100.0 * counters[search_stats::TABLEBASE_HITS] / nodes : 0.0);
+
+    write_field(line, "workers");
+    line += "[";
+    for (size_t i = 0; i < record.workers.size(); i++) {
+        if (i) line += ",";
+        line += std::to_string(record.workers[i]);
+    }
+    line += "]";
+
+    if (perf_counters::enabled()) {
+        static const char* const names[perf_counters::EVENT_COUNT] = {
+            "cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses", "cpu_ms"
+        };
+        bool first = true;
+        write_field(line, "hw");
+        line += "{";
+        for (int event = 0; event < perf_counters::EVENT_COUNT; event++) {
+            if (!perf_counters::available(perf_counters::Event(event))) {
+                continue;
+            }
+            line += first ? "\"" : ",\"";
+            line += names[event];
+            line += "\":";
+            uint64_t count = record.hardware[event];
+            if (event == perf_counters::TASK_CLOCK) {
+                write_number(line, count / 1e6);
+            } else {
+                line += std::to_string(count);
+            }
+            first = false;
+        }
+        line += "}";
+    }
+    line += "}\n";
+
+    // Flushed line by line, for readers following the stream
+    std::fputs(line.c_str(), stream);
+    std::fflush(stream);
+}
+
+const char* usage() {
+    return "[--telemetry FILE | - | fd:N]";
+}
+
+} // namespace telemetry
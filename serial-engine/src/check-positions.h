@@ -0,0 +1,30 @@
+#ifndef CHECK_POSITIONS_H
+#define CHECK_POSITIONS_H
+
+/*
+ *  check-positions
+ *
+ *  The positions search-check searches, each to a depth at which pruning once made the search report a mate
+ *  that the mated side could escape, or stop short of the depth on one. The same for every engine.
+ */
+
+namespace check_positions {
+
+struct Position {
+    const char* fen;
+    int depth;
+};
+
+constexpr Position POSITIONS[] = {
+    // Ne5 threatens Qxf7#, and every defence (...g6, ...e6, ...Nh6) is a late quiet move
+    { "r1bqkb1r/p2ppppp/n1B5/7Q/1nP5/P3PN2/1P1P1PPP/RNBK3R w kq - 3 9", 3 },
+    // Ng5 threatens Nxh7#. Once mated at depth 3 on a pruned line, which ended the search there, and refuted
+    // at depth 4
+    { "rn3kr1/p4ppp/8/b1pnQ3/P1b1p1P1/2P2N2/1P1NBP1R/R3K3 w Q - 9 27", 4 },
+};
+
+constexpr int COUNT = sizeof(POSITIONS) / sizeof(POSITIONS[0]);
+
+} // namespace check_positions
+
+#endif // CHECK_POSITIONS_H
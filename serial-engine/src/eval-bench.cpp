@@ -0,0 +1,243 @@
+/* eval-bench.cpp
+ *
+ *  Microbenchmark for the material + piece-square stage of static_eval. Plays a few thousand random games from
+ *  the start position to collect leaf boards, then reports leaf evaluations per second for
+ *
+ *      before  - the original per-square loop (isupper / tolower / switch, 63 - i flip for black)
+ *      scalar  - eval_kernel::summarise_scalar
+ *      avx2    - eval_kernel::summarise_avx2 (when the CPU supports it)
+ *
+ *  and checks that all of them agree on every board. Then, for the children of the same boards, it compares
+ *  summarising each child's board on its own with eval_kernel::summarise_children over batches of BATCH_SIZE
+ *  children (the parent summarised once), checking both give the same summaries. Build with "make eval-bench",
+ *  run with ./eval-bench [reps].
+ */
+
+#include <chrono>
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+#include "thc.h"
+#include "eval-kernel.h"
+
+// The material/PST loop as static_eval used to do it, kept here as the baseline
+static int legacy_material_pst(const char* squares) {
+    int total_score = 0;
+    for (int i = 0; i < 64; i++) {
+        char piece = squares[i];
+        if (piece == ' ')
+            continue;
+
+        int index = i;
+        int flipped_index = 63 - i; // Flips the board for Black
+        int piece_value = 0;
+        int positional_bonus = 0;
+
+        bool is_white = isupper(piece);
+        char lower_piece = tolower(piece);
+
+        switch (lower_piece) {
+            case 'p': piece_value = 100;   positional_bonus = eval_kernel::pawn_table[is_white ? index : flipped_index]; break;
+            case 'n': piece_value = 320;   positional_bonus = eval_kernel::knight_table[is_white ? index : flipped_index]; break;
+            case 'b': piece_value = 330;   positional_bonus = eval_kernel::bishop_table[is_white ? index : flipped_index]; break;
+            case 'r': piece_value = 500;   positional_bonus = eval_kernel::rook_table[is_white ? index : flipped_index]; break;
+            case 'q': piece_value = 900;   positional_bonus = eval_kernel::queen_table[is_white ? index : flipped_index]; break;
+            case 'k': piece_value = 20000; positional_bonus = eval_kernel::king_table[is_white ? index : flipped_index]; break;
+            default: break;
+        }
+
+        int square_score = piece_value + positional_bonus;
+        if (is_white) {
+            total_score += square_score;
+        } else {
+            total_score -= square_score;
+        }
+    }
+    return total_score;
+}
+
+static std::vector<std::string> collect_boards(int games, unsigned seed) {
+    std::vector<std::string> boards;
+    std::mt19937 rng(seed);
+    for (int g = 0; g < games; g++) {
+        thc::ChessRules cr;
+        int plies = 10 + static_cast<int>(rng() % 90);
+        for (int ply = 0; ply < plies; ply++) {
+            std::vector<thc::Move> moves;
+            cr.GenLegalMoveList(moves);
+            if (moves.empty())
+                break;
+            cr.PlayMove(moves[rng() % moves.size()]);
+            boards.emplace_back(cr.squares, 64);
+        }
+    }
+    return boards;
+}
+
+// A board and the boards after each of its legal moves
+struct Family {
+    std::string board;
+    std::vector<thc::Move> moves;
+    std::vector<std::string> children;
+};
+
+static std::vector<Family> collect_families(int games, unsigned seed) {
+    std::vector<Family> families;
+    std::mt19937 rng(seed);
+    for (int g = 0; g < games; g++) {
+        thc::ChessRules cr;
+        int plies = 10 + static_cast<int>(rng() % 90);
+        for (int ply = 0; ply < plies; ply++) {
+            Family family;
+            family.board.assign(cr.squares, 64);
+            cr.GenLegalMoveList(family.moves);
+            if (family.moves.empty())
+                break;
+            for (thc::Move move : family.moves) {
+                cr.PushMove(move);
+                family.children.emplace_back(cr.squares, 64);
+                cr.PopMove(move);
+            }
+            cr.PlayMove(family.moves[rng() % family.moves.size()]);
+            families.push_back(std::move(family));
+        }
+    }
+    return families;
+}
+
+// Summaries of every child of family, batch by batch, into out
+template <typename F>
+static void summarise_family(const Family& family, std::vector<eval_kernel::BoardSummary>& out, F children) {
+    eval_kernel::BoardSummary parent;
+    eval_kernel::summarise(family.board.c_str(), parent);
+    out.resize(family.moves.size());
+    for (size_t first = 0; first < family.moves.size(); first += eval_kernel::BATCH_SIZE) {
+        eval_kernel::ChildBatch batch;
+        for (size_t i = first; i < family.moves.size() && batch.count < eval_kernel::BATCH_SIZE; i++) {
+            eval_kernel::add_child(batch, family.board.c_str(), family.moves[i]);
+        }
+        children(parent, batch, &out[first]);
+    }
+}
+
+template <typename F>
+static double leaves_per_second(const std::vector<std::string>& boards, int reps, long long& checksum, F eval) {
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < reps; r++) {
+        for (const auto& board : boards) {
+            checksum += eval(board.c_str());
+        }
+    }
+    std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+    return (static_cast<double>(boards.size()) * reps) / elapsed.count();
+}
+
+int main(int argc, char* argv[]) {
+    int reps = argc > 1 ? std::atoi(argv[1]) : 50;
+    std::vector<std::string> boards = collect_boards(2000, 418);
+
+    // Correctness first: every implementation must agree with the baseline
+    for (const auto& board : boards) {
+        eval_kernel::BoardSummary scalar, avx2;
+        eval_kernel::summarise_scalar(board.c_str(), scalar);
+        int expected = legacy_material_pst(board.c_str());
+        if (scalar.material_pst != expected) {
+            std::printf("scalar mismatch: %d vs %d on %s\n", scalar.material_pst, expected, board.c_str());
+            return 1;
+        }
+        if (eval_kernel::avx2_available()) {
+            eval_kernel::summarise_avx2(board.c_str(), avx2);
+            bool same = avx2.material_pst == expected;
+            for (int code = 0; code < eval_kernel::NUM_PIECE_CODES; code++) {
+                same = same && avx2.bitboards[code] == scalar.bitboards[code];
+            }
+            if (!same) {
+                std::printf("avx2 mismatch: %d vs %d on %s\n", avx2.material_pst, expected, board.c_str());
+                return 1;
+            }
+        }
+    }
+
+    std::printf("%zu boards x %d reps, dispatch = %s\n", boards.size(), reps, eval_kernel::backend_name());
+
+    long long checksum = 0;
+    double before = leaves_per_second(boards, reps, checksum, legacy_material_pst);
+    std::printf("before  %10.2f M leaf evals/s\n", before / 1e6);
+
+    double scalar = leaves_per_second(boards, reps, checksum, [](const char* squares) {
+        eval_kernel::BoardSummary board;
+        eval_kernel::summarise_scalar(squares, board);
+        return board.material_pst;
+    });
+    std::printf("scalar  %10.2f M leaf evals/s  (%.2fx)\n", scalar / 1e6, scalar / before);
+
+    if (eval_kernel::avx2_available()) {
+        double avx2 = leaves_per_second(boards, reps, checksum, [](const char* squares) {
+            eval_kernel::BoardSummary board;
+            eval_kernel::summarise_avx2(squares, board);
+            return board.material_pst;
+        });
+        std::printf("avx2    %10.2f M leaf evals/s  (%.2fx)\n", avx2 / 1e6, avx2 / before);
+    }
+
+    // Children: every implementation must agree with summarising the child's own board
+    std::vector<Family> families = collect_families(500, 418);
+    size_t children = 0;
+    std::vector<eval_kernel::BoardSummary> summaries;
+    for (const auto& family : families) {
+        children += family.moves.size();
+        for (int avx2 = 0; avx2 <= (eval_kernel::avx2_available() ? 1 : 0); avx2++) {
+            summarise_family(family, summaries, avx2 ? eval_kernel::summarise_children_avx2
+                                                     : eval_kernel::summarise_children_scalar);
+            for (size_t i = 0; i < family.moves.size(); i++) {
+                eval_kernel::BoardSummary expected;
+                eval_kernel::summarise_scalar(family.children[i].c_str(), expected);
+                bool same = summaries[i].material_pst == expected.material_pst;
+                for (int code = 0; code < eval_kernel::NUM_PIECE_CODES; code++) {
+                    same = same && summaries[i].bitboards[code] == expected.bitboards[code];
+                }
+                if (!same) {
+                    thc::Move move = family.moves[i];
+                    std::printf("%s children mismatch: %d vs %d after %s on %s\n", avx2 ? "avx2" : "scalar",
+                                summaries[i].material_pst, expected.material_pst,
+                                move.TerseOut().c_str(), family.board.c_str());
+                    return 1;
+                }
+            }
+        }
+    }
+
+    std::printf("%zu children of %zu boards x %d reps\n", children, families.size(), reps);
+    auto children_per_second = [&](auto summarise_children) {
+        auto start = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; r++) {
+            for (const auto& family : families) {
+                summarise_children(family);
+                checksum += summaries[0].material_pst;
+            }
+        }
+        std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+        return (static_cast<double>(children) * reps) / elapsed.count();
+    };
+    double one_by_one = children_per_second([&](const Family& family) {
+        summaries.resize(family.children.size());
+        for (size_t i = 0; i < family.children.size(); i++) {
+            eval_kernel::summarise(family.children[i].c_str(), summaries[i]);
+        }
+    });
+    std::printf("each    %10.2f M children/s\n", one_by_one / 1e6);
+    double batched = children_per_second([&](const Family& family) {
+        eval_kernel::BoardSummary parent;
+        eval_kernel::summarise(family.board.c_str(), parent);
+        summaries.resize(family.moves.size());
+        eval_kernel::summarise_children(family.board.c_str(), parent, family.moves.data(), family.moves.size(),
+                                        summaries.data());
+    });
+    std::printf("batch   %10.2f M children/s  (%.2fx)\n", batched / 1e6, batched / one_by_one);
+
+    std::printf("checksum %lld\n", checksum);
+    return 0;
+}
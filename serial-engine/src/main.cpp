@@ -8,9 +8,15 @@
 
 #include <iostream>
 #include <string>
+#include <chrono>
 #include <vector>
 #include <algorithm>
+#include <cstdlib>
 #include "thc.h"
+#include "search-limits.h"
+#include "telemetry.h"
+#include "perf-counters.h"
+#include "search-thread.h"
 #include "serial-engine.h"
 
 void print_board(thc::ChessRules& cr) {
@@ -20,18 +26,39 @@ void print_board(thc::ChessRules& cr) {
 int main(int argc, char* argv[]) {
     bool computer_is_white = false;
     bool computer_is_black = false;
+    bool ponder = false;
 
-    if (argc > 1) {
-        std::string arg = argv[1];
+    search_limits::SearchLimits limits;
+    std::string telemetry_target;
+    bool count_hardware = false;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
         if (arg == "--white") {
             computer_is_white = true;
         } else if (arg == "--black") {
             computer_is_black = true;
-        } else {
-            std::cout << "Usage: " << argv[0] << " [--white | --black]" << std::endl;
+        } else if (arg == "--telemetry" && i + 1 < argc) {
+            telemetry_target = argv[++i];
+        } else if (arg == "--perf-counters") {
+            count_hardware = true;
+        } else if (arg == "--ponder") {
+            ponder = true;
+        } else if (!search_limits::parse_flag(argc, argv, i, limits)) {
+            std::cout << "Usage: " << argv[0] << " [--white | --black] [--ponder] " << search_limits::usage() << " " << telemetry::usage() << " " << perf_counters::usage() << std::endl;
             return 1;
         }
-    } else {
+    }
+    if (!telemetry_target.empty() && !telemetry::open(telemetry_target)) {
+        std::cout << "Cannot open telemetry output " << telemetry_target << std::endl;
+        return 1;
+    }
+    std::string counters_error;
+    if (count_hardware && !perf_counters::open(counters_error)) {
+        std::cout << "Cannot open hardware counters: " << counters_error << std::endl;
+        return 1;
+    }
+    if (!computer_is_white && !computer_is_black) {
         computer_is_black = true;
     }
 
@@ -40,15 +67,37 @@ int main(int argc, char* argv[]) {
 
     SerialEngine engine;
 
+    // The engine searches on a thread of its own, so it can ponder while the player thinks
+    search_thread::SearchThread<SerialEngine> searcher(engine);
+
+    // Endgame tablebases made by tablebase-generator, from $CHESS_TB_PATH or ./tablebases
+    const char* tablebase_path = std::getenv("CHESS_TB_PATH");
+    int tables = tablebase::init(tablebase_path ? tablebase_path : "tablebases");
+    if (tables > 0) {
+        std::cout << "Loaded " << tables << " endgame tablebases (up to " << tablebase::max_pieces() << " pieces)" << std::endl;
+    }
+
     bool game_over = false;
     thc::TERMINAL terminal;
 
+    // Both sides' thinking time comes off their clocks, when playing on one
+    auto move_start = std::chrono::steady_clock::now();
+
     while (!game_over) {
         if (cr.WhiteToPlay()) {
             if (computer_is_white) {
-                thc::Move best_move = engine.solve(cr, true);
+                if (!searcher.ponder_hit(cr, limits)) {
+                    searcher.start(cr, true, limits);
+                }
+                search_limits::SearchResult result = searcher.wait();
+                thc::Move best_move = result.best_move;
                 std::cout << "Computer (White) plays: " << best_move.NaturalOut(&cr) << std::endl;
                 cr.PushMove(best_move);
+
+                // Think on the reply the engine expects while the player thinks
+                if (ponder && result.pv.size() >= 2) {
+                    searcher.ponder(cr, result.pv[1], true, limits);
+                }
             } else {
                 print_board(cr);
                 std::string user_input;
@@ -71,9 +120,18 @@ int main(int argc, char* argv[]) {
             }
         } else {
             if (computer_is_black) {
-                thc::Move best_move = engine.solve(cr, false);
+                if (!searcher.ponder_hit(cr, limits)) {
+                    searcher.start(cr, false, limits);
+                }
+                search_limits::SearchResult result = searcher.wait();
+                thc::Move best_move = result.best_move;
                 std::cout << "Computer (Black) plays: " << best_move.NaturalOut(&cr) << std::endl;
                 cr.PushMove(best_move);
+
+                // Think on the reply the engine expects while the player thinks
+                if (ponder && result.pv.size() >= 2) {
+                    searcher.ponder(cr, result.pv[1], false, limits);
+                }
             } else {
                 print_board(cr);
                 std::string user_input;
@@ -96,6 +154,10 @@ int main(int argc, char* argv[]) {
             }
         }
 
+        auto move_end = std::chrono::steady_clock::now();
+        limits.spend(!cr.WhiteToPlay(), std::chrono::duration_cast<std::chrono::milliseconds>(move_end - move_start).count());
+        move_start = move_end;
+
         print_board(cr);
 
         if (cr.Evaluate(terminal)) {
@@ -0,0 +1,100 @@
+#ifndef MOVE_ORDERING_H
+#define MOVE_ORDERING_H
+
+/*
+ *  move-ordering
+ *
+ *  Ordering for quiet moves, learned from the cutoffs of the search itself. score_move can rank captures and
+ *  promotions from the board, but quiet moves all look alike to it, and they are most of the moves in a node.
+ *  Three tables remember which quiet moves refuted something before:
+ *
+ *      killers        the last two quiet moves that caused a cutoff at each ply
+ *      history        a butterfly table, [side][from][to], credited with every quiet cutoff by remaining depth
+ *      countermoves   the quiet move that last refuted a given previous move, indexed by that move's from/to
+ *
+ *  A search thread owns one Tables; nothing is shared, so updates need no locking. The tables also count the
+ *  nodes the thread has searched, and keep the principal variation of the nodes on its current path.
+ */
+
+#include <cstdint>
+#include "thc.h"
+
+namespace move_ordering {
+
+constexpr int MAX_PLY = 64;
+
+// History scores are kept within +-MAX_HISTORY
+constexpr int MAX_HISTORY = 16384;
+
+// Ordering bonuses for quiet moves, in score_move units (a pawn is 1.0)
+constexpr float KILLER_BONUS[2] = { 0.9f, 0.8f };
+constexpr float COUNTERMOVE_BONUS = 0.7f;
+constexpr float HISTORY_WEIGHT = 0.5f;    // at MAX_HISTORY
+
+// Added to captures and promotions by their static exchange class, indexed by see::Exchange: winning and even
+// exchanges go before every quiet move, losing ones after all of them
+constexpr float EXCHANGE_BONUS[3] = { -40.0f, 20.0f, 40.0f };
+
+inline bool is_quiet(const thc::Move& move) {
+    return move.capture == ' '
+        && !(move.special >= thc::SPECIAL_PROMOTION_QUEEN && move.special <= thc::SPECIAL_PROMOTION_KNIGHT);
+}
+
+struct Tables {
+    thc::Move killers[MAX_PLY][2];
+    int history[2][64][64];
+    thc::Move countermoves[64][64];
+
+    // Move played at each ply on the way to the current node, for countermoves
+    thc::Move played[MAX_PLY];
+
+    // Nodes searched, for the size of subtrees
+    uint64_t nodes;
+
+    // Best line found from the node at each ply: pv[ply][0 .. pv_length[ply] - 1]
+    thc::Move pv[MAX_PLY][MAX_PLY];
+    int pv_length[MAX_PLY];
+
+    Tables() { clear(); }
+
+    // Forget everything, at the start of a new search
+    void clear();
+
+    // Ordering bonus for a quiet move searched at ply by the side to move
+    float quiet_bonus(const thc::Move& move, int ply, bool white) const;
+
+    // Record a cutoff by a move searched at ply, with depth plies still to search below it
+    void update_cutoff(const thc::Move& move, int ply, bool white, int depth);
+
+    // The move that led to the node at ply, or an invalid move at the root (or after a null move)
+    thc::Move previous(int ply) const;
+
+    bool is_killer(const thc::Move& move, int ply) const {
+        return ply < MAX_PLY && (move == killers[ply][0] || move == killers[ply][1]);
+    }
+
+    // History score of a quiet move for the side to move, in [0, MAX_HISTORY)
+    int history_score(const thc::Move& move, bool white) const {
+        return history[white][move.src][move.dst];
+    }
+
+    // Entering a node at ply: no line from it yet
+    void enter(int ply) {
+        nodes++;
+        if (ply < MAX_PLY) {
+            pv_length[ply] = 0;
+        }
+    }
+
+    // move is the new best at ply: its line is move followed by the line just found from ply + 1
+    void update_pv(const thc::Move& move, int ply);
+};
+
+// Percentage of cutoffs that came from the first move searched
+inline double first_move_cutoff_rate(uint64_t first_move_cutoffs, uint64_t cutoffs) {
+    return cutoffs ? 100.0 * first_move_cutoffs / cutoffs : 0.0;
+}
+
+} // namespace move_ordering
+
+#endif // MOVE_ORDERING_H
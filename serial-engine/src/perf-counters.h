@@ -0,0 +1,75 @@
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+/*
+ *  perf-counters
+ *
+ *  Hardware performance counters of the search, read through Linux perf_event_open, for comparing board
+ *  representations and memory layouts on the machine the engine runs on without running perf there. With the
+ *  mode on (--perf-counters), every search thread counts its own cycles, instructions, L1 data cache read
+ *  misses, last level cache misses, branch misses and CPU time, in user space only. solve() reads them around
+ *  each iteration and the whole search and prints them per node evaluated, next to the debug line:
+ *
+ *      Hardware: IPC 2.41, cycles/node 6210, L1d misses/node 21.3, LLC misses/node 0.08, branch misses/node 17.9,
+ *      CPU 0.21s
+ *
+ *  Counters the processor or the kernel does not offer (in most virtual machines, all but the CPU time) are left
+ *  out of the report. When the kernel runs more counters than the processor has, each is scaled up by the share
+ *  of the time it was counting. Other systems than Linux have no counters and open() fails.
+ *
+ *  A thread counts from the first attach() it makes, into the slot it gives: 0 for the serial and MPI engines,
+ *  the OpenMP thread number for the OpenMP ones. read() can be called from any thread.
+ */
+
+#include <array>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace perf_counters {
+
+enum Event {
+    CYCLES,
+    INSTRUCTIONS,
+    L1D_MISSES,         // L1 data cache read misses
+    LLC_MISSES,         // last level cache misses
+    BRANCH_MISSES,
+    TASK_CLOCK,         // CPU time, in nanoseconds
+    EVENT_COUNT
+};
+
+using Values = std::array<uint64_t, EVENT_COUNT>;
+
+// Turn the counters on and start counting on the calling thread, as slot 0. False with the reason in error if
+// none of the events can be opened.
+bool open(std::string& error);
+
+// Whether open() has succeeded
+bool enabled();
+
+// Whether the machine counts this event
+bool available(Event event);
+
+// Count the calling thread in slot, if enabled. A thread already counting in slot keeps its counts; another
+// thread in the slot takes it over from zero.
+void attach(int slot);
+
+// The counts so far of every slot
+std::vector<Values> read();
+
+// Counts between two reads, slot by slot. A slot taken over in between counts from zero.
+Values difference(const Values& later, const Values& earlier);
+std::vector<Values> difference(const std::vector<Values>& later, const std::vector<Values>& earlier);
+
+// The counts of all the slots together
+Values total(const std::vector<Values>& per_slot);
+
+// IPC, cycles and misses per node evaluated (left out if nodes is 0), and CPU time
+std::string describe(const Values& counts, uint64_t nodes);
+
+// Flag for the engines' command lines
+const char* usage();
+
+} // namespace perf_counters
+
+#endif // PERF_COUNTERS_H
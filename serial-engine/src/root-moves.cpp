@@ -0,0 +1,113 @@
+/*
+ *  root-moves
+ *
+ *  See root-moves.h.
+ */
+
+#include <algorithm>
+#include <limits>
+#include "root-moves.h"
+
+namespace root_moves {
+
+bool RootMoves::begin(thc::ChessRules& cr) {
+    for (auto& root_move : list) {
+        root_move.pending_searched = false;
+    }
+    pending_pv.clear();
+    first.Invalid();
+
+    if (!list.empty() && root == cr) {
+        return true;
+    }
+    if (have_prediction && predicted == cr) {
+        first = predicted_move;
+    }
+    root = cr;
+    have_prediction = false;
+    return false;
+}
+
+void RootMoves::reset(const std::vector<std::pair<float, thc::Move>>& scored_moves) {
+    list.clear();
+    pv.clear();
+    for (const auto& scored : scored_moves) {
+        RootMove root_move;
+        root_move.move = scored.second;
+        root_move.score = 0.0f;
+        root_move.nodes = 0;
+        root_move.searched = false;
+        root_move.pending_score = 0.0f;
+        root_move.pending_nodes = 0;
+        root_move.pending_searched = false;
+        list.push_back(root_move);
+    }
+
+    auto predicted_first = std::find_if(list.begin(), list.end(), [&](const RootMove& root_move) {
+        return root_move.move == first;
+    });
+    if (first.Valid() && predicted_first != list.end()) {
+        std::rotate(list.begin(), predicted_first, predicted_first + 1);
+    }
+}
+
+void RootMoves::record(const thc::Move& move, float score, uint64_t nodes) {
+    for (auto& root_move : list) {
+        if (root_move.move == move) {
+            root_move.pending_score = score;
+            root_move.pending_nodes = nodes;
+            root_move.pending_searched = true;
+            return;
+        }
+    }
+}
+
+void RootMoves::record_pv(const thc::Move* line, int length) {
+    pending_pv.assign(line, line + length);
+}
+
+void RootMoves::complete(bool white_to_move) {
+    for (auto& root_move : list) {
+        if (root_move.pending_searched) {
+            root_move.score = root_move.pending_score;
+            root_move.nodes = root_move.pending_nodes;
+            root_move.searched = true;
+            root_move.pending_searched = false;
+        }
+    }
+    if (!pending_pv.empty()) {
+        pv = pending_pv;
+        pending_pv.clear();
+    }
+
+    // Best move first, then the rest by score for the side to move, then by subtree size. Moves no iteration
+    // has searched yet keep their static order, after the others.
+    thc::Move best;
+    best.Invalid();
+    if (!pv.empty()) {
+        best = pv[0];
+    }
+    std::stable_sort(list.begin(), list.end(), [&](const RootMove& a, const RootMove& b) {
+        if ((a.move == best) != (b.move == best)) return a.move == best;
+        if (a.searched != b.searched) return a.searched;
+        if (!a.searched) return false;
+        float a_score = white_to_move ? a.score : -a.score;
+        float b_score = white_to_move ? b.score : -b.score;
+        if (a_score != b_score) return a_score > b_score;
+        return a.nodes > b.nodes;
+    });
+}
+
+void RootMoves::end(thc::ChessRules& cr) {
+    have_prediction = pv.size() >= 3;
+    if (!have_prediction) {
+        return;
+    }
+    thc::ChessRules board = cr;
+    board.PlayMove(pv[0]);
+    board.PlayMove(pv[1]);
+    predicted = board;
+    predicted_move = pv[2];
+}
+
+} // namespace root_moves
@@ -0,0 +1,83 @@
+#ifndef ROOT_MOVES_H
+#define ROOT_MOVES_H
+
+/*
+ *  root-moves
+ *
+ *  The moves of the root position, kept from one iteration of iterative deepening to the next. score_move only
+ *  sees the board, but by the end of an iteration the root knows much more: which move was best, what each
+ *  of the others scored, and how many nodes it took to refute them (a move that needed a big subtree is a
+ *  serious alternative). The next iteration searches the best move first, then the others by score and subtree
+ *  size, which is also the order in which the parallel engines hand them out.
+ *
+ *  The list also outlives solve(). Searching the same position again reuses it as it is, and when the game
+ *  has gone along the principal variation of the last search (our best move, then the reply it expected) the
+ *  move that variation predicted next is searched first.
+ *
+ *  Iteration results are recorded as the root moves are searched but only kept when the iteration completes,
+ *  so an iteration cut short by the clock leaves the list as it was.
+ */
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "thc.h"
+
+namespace root_moves {
+
+struct RootMove {
+    thc::Move move;
+    float score;            // white minus black, from the last completed iteration that searched it
+    uint64_t nodes;         // nodes in its subtree in that iteration
+    bool searched;          // whether any completed iteration has searched it
+
+    float pending_score;    // the same for the iteration under way, pending_searched once it has a result
+    uint64_t pending_nodes;
+    bool pending_searched;
+};
+
+class RootMoves {
+public:
+    // Start a search from cr. True if the list of the previous search carries over (it is the same position),
+    // false if it has to be built afresh with reset()
+    bool begin(thc::ChessRules& cr);
+
+    // New list from the moves of the position, best static score first
+    void reset(const std::vector<std::pair<float, thc::Move>>& scored_moves);
+
+    const std::vector<RootMove>& moves() const { return list; }
+
+    // Result of a root move in the iteration under way. A later record for the same move replaces it.
+    void record(const thc::Move& move, float score, uint64_t nodes);
+
+    // Principal variation of the iteration under way, recorded when its best move changes
+    void record_pv(const thc::Move* line, int length);
+
+    // The iteration completed: keep its results and reorder the list for the next one
+    void complete(bool white_to_move);
+
+    // The search from cr is over: work out where its principal variation leads
+    void end(thc::ChessRules& cr);
+
+    // Best line of the last completed iteration
+    const std::vector<thc::Move>& principal_variation() const { return pv; }
+
+private:
+    std::vector<RootMove> list;
+    thc::ChessPosition root;
+
+    std::vector<thc::Move> pv;
+    std::vector<thc::Move> pending_pv;
+
+    // Position two plies along the last principal variation, and the move the variation plays there
+    thc::ChessPosition predicted;
+    thc::Move predicted_move;
+    bool have_prediction = false;
+
+    // Move to put first in the list reset() builds
+    thc::Move first;
+};
+
+} // namespace root_moves
+
+#endif // ROOT_MOVES_H
@@ -0,0 +1,97 @@
+#!/bin/sh
+# scaling-bench.sh
+#
+# Parallel scaling of the alpha-beta engines over the positions of bench-positions.h at a fixed depth. Runs
+# search-bench of the serial engine once, and of the OpenMP and MPI engines with each number of threads or ranks
+# in WORKERS, then prints one CSV line per engine, worker count and position, and one for all positions together
+# (position "all"):
+#
+#   engine,workers,position,depth,seconds,nodes,speedup,search_overhead,efficiency,idle_per_worker_s
+#
+#   speedup             serial engine's time to the depth / this time
+#   search_overhead     nodes / serial engine's nodes, the extra tree a parallel search pays for
+#   efficiency          speedup / workers
+#   idle_per_worker_s   time, averaged over the workers, a worker was not searching: the search time less the time
+#                       the worker's own nodes take at the engine's one-worker rate on the position. An estimate,
+#                       which counts waiting on other workers and on messages alike.
+#
+# Run it through "make scaling-bench", which builds the three search-bench binaries first. Settings, from the
+# environment:
+#
+#   DEPTH     plies to search each position to (7)
+#   WORKERS   thread and rank counts to run ("1 2 4 ... " up to the number of CPUs); 1 is always run
+#   MPIRUN    how to start MPI jobs ("mpirun"), e.g. "mpirun --oversubscribe"
+
+DEPTH=${DEPTH:-7}
+MPIRUN=${MPIRUN:-mpirun}
+if [ -z "$WORKERS" ]; then
+    cpus=$(getconf _NPROCESSORS_ONLN 2>/dev/null || echo 1)
+    WORKERS=1
+    n=2
+    while [ "$n" -lt "$cpus" ]; do
+        WORKERS="$WORKERS $n"
+        n=$((n * 2))
+    done
+    [ "$cpus" -gt 1 ] && WORKERS="$WORKERS $cpus"
+fi
+case " $WORKERS " in
+    *" 1 "*) ;;
+    *) WORKERS="1 $WORKERS" ;;
+esac
+
+here=$(dirname "$0")
+runs=$(mktemp) || exit 1
+trap 'rm -f "$runs"' EXIT
+
+echo "serial engine, depth $DEPTH" >&2
+"$here/search-bench" "$DEPTH" >> "$runs" || exit 1
+for workers in $WORKERS; do
+    echo "OpenMP engine, $workers threads" >&2
+    "$here/../../omp-engine/src/search-bench" "$DEPTH" "$workers" >> "$runs" || exit 1
+done
+for workers in $WORKERS; do
+    echo "MPI engine, $workers ranks" >&2
+    $MPIRUN -np "$workers" "$here/../../mpi-engine/src/search-bench" "$DEPTH" >> "$runs" || exit 1
+done
+
+awk -F, '
+function idle(seconds, nodes, rate,    i, n, total, busy) {
+    n = split(nodes, worker, " ")
+    total = 0
+    for (i = 1; i <= n; i++) {
+        busy = rate > 0 ? worker[i] / rate : seconds
+        total += busy < seconds ? seconds - busy : 0
+    }
+    return n ? total / n : 0
+}
+function line(engine, workers, position, depth, seconds, nodes, idle_seconds,    speedup, overhead) {
+    speedup = seconds > 0 ? serial_seconds[position] / seconds : 0
+    overhead = serial_nodes[position] > 0 ? nodes / serial_nodes[position] : 0
+    printf "%s,%d,%s,%d,%.4f,%.0f,%.3f,%.3f,%.3f,%.4f\n", engine, workers, position, depth, seconds, nodes,
+           speedup, overhead, speedup / workers, idle_seconds
+}
+{
+    engine[NR] = $1; workers[NR] = $2; position[NR] = $3; depth[NR] = $4
+    seconds[NR] = $5; nodes[NR] = $6; worker_nodes[NR] = $7
+    if ($1 == "serial") {
+        serial_seconds[$3] = $5; serial_nodes[$3] = $6
+        serial_seconds["all"] += $5; serial_nodes["all"] += $6
+    }
+    if ($2 == 1 && $5 > 0) {
+        rate[$1, $3] = $6 / $5
+    }
+}
+END {
+    print "engine,workers,position,depth,seconds,nodes,speedup,search_overhead,efficiency,idle_per_worker_s"
+    for (i = 1; i <= NR; i++) {
+        idle_seconds = idle(seconds[i], worker_nodes[i], rate[engine[i], position[i]])
+        line(engine[i], workers[i], position[i], depth[i], seconds[i], nodes[i], idle_seconds)
+
+        run = engine[i] SUBSEP workers[i]
+        total_seconds[run] += seconds[i]; total_nodes[run] += nodes[i]; total_idle[run] += idle_seconds
+        deepest[run] = depth[i] > deepest[run] ? depth[i] : deepest[run]
+        if (i == NR || engine[i + 1] != engine[i] || workers[i + 1] != workers[i]) {
+            line(engine[i], workers[i], "all", deepest[run], total_seconds[run], total_nodes[run], total_idle[run])
+        }
+    }
+}' "$runs"
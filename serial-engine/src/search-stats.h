@@ -0,0 +1,127 @@
+#ifndef SEARCH_STATS_H
+#define SEARCH_STATS_H
+
+/*
+ *  search-stats
+ *
+ *  Counts of what the search did, for the debug output and the node limit. Every search thread (every rank, in
+ *  the MPI engines) counts into a Counters of its own, and the counts are only added up when they are reported.
+ *  A Counters is one cache line, aligned to one, so threads counting side by side never write to the same line;
+ *  a single shared counter would move its line from core to core at every node.
+ *
+ *  Only the owning thread adds to its counters, so an increment is a plain load and store rather than an atomic
+ *  read-modify-write. They are atomics anyway so that other threads can read a running total while it counts.
+ *
+ *  Besides the counts a Counters keeps the selective depth, the deepest ply reached, quiescence included. It is a
+ *  maximum rather than a sum, so it stays out of values() and is combined separately.
+ */
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace search_stats {
+
+constexpr std::size_t CACHE_LINE = 64;
+
+enum Counter {
+    NODES,                  // nodes of the main search
+    QNODES,                 // nodes of the quiescence search
+    EVALUATED,              // positions scored: quiescence nodes, and the mates, stalemates and tablebase results
+                            // of the main search. The node limit and the debug output count these.
+    TABLEBASE_HITS,         // nodes scored by the tablebases or the KPK bitbase
+    CUTOFFS,                // nodes that failed high
+    FIRST_MOVE_CUTOFFS,     // and of those, the ones that did on the first move searched
+    NULL_MOVE_CUTOFFS,
+    PRUNED_MOVES,           // moves not searched, by futility or late move pruning
+    COUNTER_COUNT
+};
+
+using Values = std::array<uint64_t, COUNTER_COUNT>;
+
+class alignas(CACHE_LINE) Counters {
+public:
+    Counters() { clear(); }
+    explicit Counters(const Values& values, int seldepth = 0) {
+        set(values);
+        max_ply.store(seldepth, std::memory_order_relaxed);
+    }
+    Counters(const Counters& other) : Counters(other.values(), other.seldepth()) {}
+    Counters& operator=(const Counters& other) {
+        set(other.values());
+        max_ply.store(other.seldepth(), std::memory_order_relaxed);
+        return *this;
+    }
+
+    // By the owning thread only
+    void add(Counter counter, uint64_t amount = 1) {
+        count[counter].store(count[counter].load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+    }
+
+    // A node failed high on its move_number-th move
+    void add_cutoff(int move_number) {
+        add(CUTOFFS);
+        if (move_number == 0) {
+            add(FIRST_MOVE_CUTOFFS);
+        }
+    }
+
+    // A node at ply was searched, by the owning thread
+    void reach(int ply) {
+        if (ply > max_ply.load(std::memory_order_relaxed)) {
+            max_ply.store(ply, std::memory_order_relaxed);
+        }
+    }
+
+    uint64_t operator[](Counter counter) const { return count[counter].load(std::memory_order_relaxed); }
+
+    int seldepth() const { return max_ply.load(std::memory_order_relaxed); }
+
+    void clear() {
+        set(Values{});
+        max_ply.store(0, std::memory_order_relaxed);
+    }
+
+    Values values() const {
+        Values values;
+        for (int i = 0; i < COUNTER_COUNT; i++) {
+            values[i] = (*this)[Counter(i)];
+        }
+        return values;
+    }
+
+    Counters& operator+=(const Counters& other) {
+        for (int i = 0; i < COUNTER_COUNT; i++) {
+            add(Counter(i), other[Counter(i)]);
+        }
+        reach(other.seldepth());
+        return *this;
+    }
+
+private:
+    void set(const Values& values) {
+        for (int i = 0; i < COUNTER_COUNT; i++) {
+            count[i].store(values[i], std::memory_order_relaxed);
+        }
+    }
+
+    std::atomic<uint64_t> count[COUNTER_COUNT];
+    std::atomic<int> max_ply;
+};
+
+static_assert(sizeof(Counters) % CACHE_LINE == 0, "Counters must not share a cache line");
+
+// The counts of all the threads together
+inline Counters total(const std::vector<Counters>& per_thread) {
+    Counters sum;
+    for (const auto& counters : per_thread) {
+        sum += counters;
+    }
+    return sum;
+}
+
+} // namespace search_stats
+
+#endif // SEARCH_STATS_H
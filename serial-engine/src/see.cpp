@@ -0,0 +1,166 @@
+/*
+ *  see
+ *
+ *  See see.h. This is the usual swap list algorithm: play the exchange out on a copy of the board, recording after
+ *  each capture what the side that made it would be left with if the exchange stopped there, then let each side
+ *  pick the better of stopping or going on, from the last capture back to the first.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include "see.h"
+#include "eval-kernel.h"
+
+namespace thc {
+
+// thc's attack lookup tables (declared privately in thc.cpp). attacks_black_lookup[sq] lists the rays along which
+// white pieces could attack a black piece on sq, each square with a mask of the piece types that attack from
+// there (see to_mask); attacks_white_lookup the same for black pieces.
+extern lte to_mask[];
+extern const lte* knight_lookup[];
+extern const lte* attacks_white_lookup[];
+extern const lte* attacks_black_lookup[];
+
+} // namespace thc
+
+namespace see {
+
+namespace {
+
+int piece_value(char piece) {
+    switch (piece) {
+        case 'P': case 'p': return eval_kernel::PAWN_VALUE;
+        case 'N': case 'n': return eval_kernel::KNIGHT_VALUE;
+        case 'B': case 'b': return eval_kernel::BISHOP_VALUE;
+        case 'R': case 'r': return eval_kernel::ROOK_VALUE;
+        case 'Q': case 'q': return eval_kernel::QUEEN_VALUE;
+        case 'K': case 'k': return eval_kernel::KING_VALUE;
+        default:            return 0;
+    }
+}
+
+bool is_white(char piece) {
+    return piece >= 'A' && piece <= 'Z';
+}
+
+char promoted_piece(const thc::Move& move, bool white) {
+    char piece;
+    switch (move.special) {
+        case thc::SPECIAL_PROMOTION_QUEEN:  piece = 'q'; break;
+        case thc::SPECIAL_PROMOTION_ROOK:   piece = 'r'; break;
+        case thc::SPECIAL_PROMOTION_BISHOP: piece = 'b'; break;
+        case thc::SPECIAL_PROMOTION_KNIGHT: piece = 'n'; break;
+        default:                            return 0;
+    }
+    return white ? (char)(piece - 'a' + 'A') : piece;
+}
+
+// Square of the least valuable piece of one side attacking target, -1 if there is none
+int least_valuable_attacker(const char* board, int target, bool white) {
+    int best = -1;
+    int best_value = 0;
+    auto consider = [&](int sq) {
+        int value = piece_value(board[sq]);
+        if (best < 0 || value < best_value) {
+            best = sq;
+            best_value = value;
+        }
+    };
+
+    const thc::lte* ptr = white ? thc::attacks_black_lookup[target] : thc::attacks_white_lookup[target];
+    int rays = *ptr++;
+    while (rays--) {
+        int length = *ptr++;
+        while (length--) {
+            int sq = *ptr++;
+            thc::lte mask = *ptr++;
+            char piece = board[sq];
+            if (piece == ' ') {
+                continue;
+            }
+            // First piece along the ray: it attacks, or it blocks whatever stands behind it
+            if (is_white(piece) == white && (thc::to_mask[(int)piece] & mask)) {
+                consider(sq);
+            }
+            ptr += 2 * length;
+            length = 0;
+        }
+    }
+
+    char knight = white ? 'N' : 'n';
+    ptr = thc::knight_lookup[target];
+    int squares = *ptr++;
+    while (squares--) {
+        int sq = *ptr++;
+        if (board[sq] == knight) {
+            consider(sq);
+        }
+    }
+    return best;
+}
+
+} // namespace
+
+int evaluate(const thc::ChessRules& cr, const thc::Move& move) {
+    char board[64];
+    std::memcpy(board, cr.squares, 64);
+
+    int from = move.src;
+    int to = move.dst;
+    char piece = board[from];
+    bool white = is_white(piece);
+
+    int gain[32];
+    int d = 0;
+
+    // The first capture, which is the move itself
+    if (move.special == thc::SPECIAL_WEN_PASSANT || move.special == thc::SPECIAL_BEN_PASSANT) {
+        // The captured pawn is behind the destination square, seen from the capturing side
+        board[white ? to + 8 : to - 8] = ' ';
+        gain[0] = eval_kernel::PAWN_VALUE;
+    } else {
+        gain[0] = piece_value(board[to]);
+    }
+    if (char promoted = promoted_piece(move, white)) {
+        gain[0] += piece_value(promoted) - eval_kernel::PAWN_VALUE;
+        piece = promoted;
+    }
+    board[from] = ' ';
+    board[to] = piece;
+    int on_target = piece_value(piece);
+
+    // Then alternate recaptures, least valuable attacker first
+    bool side = !white;
+    while (d < 31) {
+        int sq = least_valuable_attacker(board, to, side);
+        if (sq < 0) {
+            break;
+        }
+        char attacker = board[sq];
+
+        // A king may only take last
+        if (attacker == 'K' || attacker == 'k') {
+            board[sq] = ' ';
+            bool defended = least_valuable_attacker(board, to, !side) >= 0;
+            board[sq] = attacker;
+            if (defended) {
+                break;
+            }
+        }
+
+        d++;
+        gain[d] = on_target - gain[d - 1];
+        on_target = piece_value(attacker);
+        board[sq] = ' ';
+        board[to] = attacker;
+        side = !side;
+    }
+
+    while (d > 0) {
+        gain[d - 1] = -std::max(-gain[d - 1], gain[d]);
+        d--;
+    }
+    return gain[0];
+}
+
+} // namespace see
@@ -32,6 +32,8 @@
  *                                                     ^
  *                                                  Use results for this one
  * 
+ *  Deepening stops early once an iteration proves a mate within its depth.
+ * 
  * 
  *  Static evaluation + Alpha-beta pruning (Implemented)
  * 
@@ -46,18 +48,41 @@
  * 
  *  Move reordering (Implemented)
  *  If we search branches with "important" moves first, this will greatly help with alpha-beta pruning. 
+ *  Captures and promotions that do not lose material go first, losing captures last. Quiet moves are ranked by
+ *  killers, countermoves and the history table, which remember the quiet moves that caused cutoffs earlier in the
+ *  search (see move-ordering.h). The root searches its moves in the order the previous iteration left them, its
+ *  best move first (see root-moves.h).
  *
  * 
- *  Quiescence Search (Unimplemented)
+ *  Quiescence Search (Implemented)
+ * 
+ *  At the end of each move we should continue searching until captures are no longer possible. Captures that
+ *  lose material by static exchange evaluation (see.h) are left out there, and searched one ply shallower in the
+ *  main search.
+ * 
+ *  Null move pruning (Implemented)
+ * 
+ *  Let the side to move pass: if a shallower search still finds it winning a cutoff, skip searching its real moves.
+ * 
+ *  Futility pruning, reverse futility and razoring (Implemented)
+ * 
+ *  A few plies from the horizon, the static eval of a node decides whether it is worth searching at all, and
+ *  whether its quiet moves are.
  * 
- *  At the end of each move we should continue searching until captures are no longer possible.
+ *  Late move reductions and pruning (Implemented)
+ * 
+ *  Quiet moves late in the ordering are searched with fewer plies, by an amount that grows with depth and move
+ *  number, and near the leaves the last of them are skipped (see late-moves.h).
  * 
  *  Transposition Tables (Unimplemented)
  *  
  *  To help speed up search, different transpositions that have already been scored should be stored in a hash map. This prevents
  *  needing to search the same position twice (DP).
  * 
- *  Syzygy (Unimplemented) 
+ *  Endgame tablebases (Implemented)
+ *
+ *  Instead of Syzygy, tablebase-generator solves every ending of up to 5 pieces by retrograde analysis. Once few
+ *  enough pieces are left, search() looks the result up in the memory-mapped tables and stops there (see tablebase.h).
  */
 
 
@@ -68,77 +93,12 @@
 #include <cmath>    
 #include <iostream>
 
-// Piece-square tables for evaluation (a.k.a. heat maps)
-const int pawn_table[64] = {
-     0,  0,  0,  0,  0,  0,  0,  0,
-    50, 50, 50, 50, 50, 50, 50, 50,
-    10, 10, 20, 30, 30, 20, 10, 10,
-     5,  5, 10, 25, 25, 10,  5,  5,
-     0,  0,  0, 20, 20,  0,  0,  0,
-     5, -5,-10,  0,  0,-10, -5,  5,
-     5, 10, 10,-20,-20, 10, 10,  5,
-     0,  0,  0,  0,  0,  0,  0,  0
-};
-
-const int knight_table[64] = {
-    -50,-40,-30,-30,-30,-30,-40,-50,
-    -40,-20,  0,  0,  0,  0,-20,-40,
-    -30,  0, 10, 15, 15, 10,  0,-30,
-    -30,  5, 15, 20, 20, 15,  5,-30,
-    -30,  0, 15, 20, 20, 15,  0,-30,
-    -30,  5, 10, 15, 15, 10,  5,-30,
-    -40,-20,  0,  5,  5,  0,-20,-40,
-    -50,-40,-30,-30,-30,-30,-40,-50
-};
-
-const int bishop_table[64] = {
-    -20,-10,-10,-10,-10,-10,-10,-20,
-    -10,  0,  0,  0,  0,  0,  0,-10,
-    -10,  0,  5, 10, 10,  5,  0,-10,
-    -10,  5,  5, 10, 10,  5,  5,-10,
-    -10,  0, 10, 10, 10, 10,  0,-10,
-    -10, 10, 10, 10, 10, 10, 10,-10,
-    -10,  5,  0,  0,  0,  0,  5,-10,
-    -20,-10,-10,-10,-10,-10,-10,-20
-};
-
-const int rook_table[64] = {
-     0,  0,  0,  0,  0,  0,  0,  0,
-     5, 10, 10, 10, 10, 10, 10,  5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-    -5,  0,  0,  0,  0,  0,  0, -5,
-     0,  0,  0,  5,  5,  0,  0,  0
-};
-
-const int queen_table[64] = {
-    -20,-10,-10, -5, -5,-10,-10,-20,
-    -10,  0,  0,  0,  0,  0,  0,-10,
-    -10,  0,  5,  5,  5,  5,  0,-10,
-     -5,  0,  5,  5,  5,  5,  0, -5,
-      0,  0,  5,  5,  5,  5,  0, -5,
-    -10,  5,  5,  5,  5,  5,  0,-10,
-    -10,  0,  5,  0,  0,  0,  0,-10,
-    -20,-10,-10, -5, -5,-10,-10,-20
-};
-
-const int king_table[64] = {
-    -30,-40,-40,-50,-50,-40,-40,-30,
-    -30,-40,-40,-50,-50,-40,-40,-30,
-    -30,-40,-40,-50,-50,-40,-40,-30,
-    -30,-40,-40,-50,-50,-40,-40,-30,
-    -20,-30,-30,-40,-40,-30,-30,-20,
-    -10,-20,-20,-20,-20,-20,-20,-10,
-     20, 20,  0,  0,  0,  0, 20, 20,
-     20, 30, 10,  0,  0, 10, 30, 20
-};
-
-/* Helper function for move scoring. Capturing larger piece is prioritized first.
+/* Helper function for move scoring. Captures and promotions are classed by static exchange evaluation: those
+ * that win material first, then even trades, then quiet moves, and captures that lose material last. Within a
+ * class capturing the larger piece is prioritized first.
  */
 
-float SerialEngine::score_move(const thc::Move& move, thc::ChessRules& cr) {
+float SerialEngine::score_move(const thc::Move& move, thc::ChessRules& cr, int ply) {
     float score = 0.0f;
 
     // Check if the move is a capture
@@ -159,39 +119,25 @@ float SerialEngine::score_move(const thc::Move& move, thc::ChessRules& cr) {
         score += 9.0f; 
     }
 
+    if (!move_ordering::is_quiet(move)) {
+        score += move_ordering::EXCHANGE_BONUS[see::classify(see::evaluate(cr, move))];
+    }
+
     // Positional gain
     int from_index = static_cast<int>(move.src);
     int to_index = static_cast<int>(move.dst);
-    char piece = cr.squares[from_index];
+    score += eval_kernel::psqt_delta(cr.squares[from_index], from_index, to_index) / 100.0f;
 
-    if (isupper(piece)) { // White pieces
-        switch (piece) {
-            case 'P': score += (pawn_table[to_index] - pawn_table[from_index]) / 100.0f; break;
-            case 'N': score += (knight_table[to_index] - knight_table[from_index]) / 100.0f; break;
-            case 'B': score += (bishop_table[to_index] - bishop_table[from_index]) / 100.0f; break;
-            case 'R': score += (rook_table[to_index] - rook_table[from_index]) / 100.0f; break;
-            case 'Q': score += (queen_table[to_index] - queen_table[from_index]) / 100.0f; break;
-            case 'K': score += (king_table[to_index] - king_table[from_index]) / 100.0f; break;
-        }
-    } else { // Black pieces
-        int flipped_from_index = 63 - from_index;
-        int flipped_to_index = 63 - to_index;
-
-        switch (piece) {
-            case 'p': score += (pawn_table[flipped_to_index] - pawn_table[flipped_from_index]) / 100.0f; break;
-            case 'n': score += (knight_table[flipped_to_index] - knight_table[flipped_from_index]) / 100.0f; break;
-            case 'b': score += (bishop_table[flipped_to_index] - bishop_table[flipped_from_index]) / 100.0f; break;
-            case 'r': score += (rook_table[flipped_to_index] - rook_table[flipped_from_index]) / 100.0f; break;
-            case 'q': score += (queen_table[flipped_to_index] - queen_table[flipped_from_index]) / 100.0f; break;
-            case 'k': score += (king_table[flipped_to_index] - king_table[flipped_from_index]) / 100.0f; break;
-        }
+    // Quiet moves that refuted something earlier in the search (killers, countermove, history)
+    if (move_ordering::is_quiet(move)) {
+        score += ordering.quiet_bonus(move, ply, cr.white);
     }
 
     return score;
 }
 
 // Add a mobility bonus for the pieces (not sure if this helps).
-int SerialEngine::evaluate_mobility(thc::ChessRules& cr, bool is_white, const std::vector<int>& piece_indices) {
+int SerialEngine::evaluate_mobility(thc::ChessRules& cr, bool is_white) {
     int mobility_score = 0;
     thc::ChessRules cr_copy = cr;
     std::vector<thc::Move> moves;
@@ -214,13 +160,13 @@ int SerialEngine::evaluate_mobility(thc::ChessRules& cr, bool is_white, const st
     return mobility_score;
 }
 
-int SerialEngine::evaluate_pawn_structure(const std::vector<int>& pawn_files, bool is_white) {
+int SerialEngine::evaluate_pawn_structure(uint64_t pawns, bool is_white) {
     int score = 0;
 
     // Count pawns on each file
     int file_counts[8] = {0};
-    for (int file : pawn_files) {
-        file_counts[file]++;
+    for (int i = 0; i < 8; ++i) {
+        file_counts[i] = __builtin_popcountll(pawns & (0x0101010101010101ULL << i));
     }
 
     // Evaluate pawn structure
@@ -333,176 +279,339 @@ int SerialEngine::evaluate_king_activity(int own_king_index, int opponent_king_i
 }
 
 
-const int ENDGAME_MATERIAL_THRESHOLD = 2400; // Adjust based on testing
+/* A tablebase result is scored like the mate it leads to, counting the plies already searched, so the engine
+ * prefers quicker wins and slower losses just as it does for mates found by search. */
+bool SerialEngine::probe_tablebase(const thc::ChessRules& cr, int depth, Score& score) {
+    tablebase::Wdl wdl;
+    int plies;
+    if (!tablebase::probe(cr, wdl, plies)) {
+        return false;
+    }
+    if (wdl == tablebase::DRAW) {
+        score = 0.0f;
+        return true;
+    }
+
+    Score mate = INF_SCORE - (depth + (plies < 0 ? TABLEBASE_MATE_PLIES : plies));
+    score = (wdl == tablebase::WIN) == cr.white ? mate : -mate;
+    return true;
+}
+
+/* Lazy evaluation. The terms of static_eval are added cheapest first, and after each stage we check whether the
+ * terms still to come could bring the score back inside (alpha, beta). If not, the leaf is already a fail-low or
+ * fail-high for its parent, so we return the most optimistic (resp. pessimistic) score it could still reach and
+ * skip the rest, mobility in particular since it generates the legal moves.
+ *
+ * The bounds below are how far each term can move the score (white minus black, both sides together):
+ *   pawn structure  each side scores between -145 (7 doubled, 4 islands, 4 isolated files) and +5 (no pawns)
+ *   king safety     each side scores between -20 and +30, only outside the endgame
+ *   king activity   each side scores between -43 and +43, only in the endgame
+ *   mobility        see mobility_bound(), from the piece counts
+ * The final material scaling only ever moves a score towards 0, so it is applied to the bounds as well.
+ */
+const int PAWN_STRUCTURE_BOUND = 150;
+const int KING_SAFETY_BOUND = 50;
+const int KING_ACTIVITY_BOUND = 86;
+
+// Most mobility one side can score: every piece with its maximum number of moves
+int SerialEngine::mobility_bound(const eval_kernel::BoardSummary& board, bool is_white) {
+    int base = is_white ? eval_kernel::WP : eval_kernel::BP;
+    return eval_kernel::piece_count(board, base + 1) * 8 * 4      // knights
+         + eval_kernel::piece_count(board, base + 2) * 13 * 4     // bishops
+         + eval_kernel::piece_count(board, base + 3) * 14 * 2     // rooks
+         + eval_kernel::piece_count(board, base + 4) * 27 * 1;    // queens
+}
 
-bool SerialEngine::is_endgame(int white_material, int black_material) {
-    int total_material = white_material + black_material;
-    return total_material <= ENDGAME_MATERIAL_THRESHOLD; // Define a threshold, e.g., 2400 (two rooks)
+SerialEngine::Score SerialEngine::static_eval(thc::ChessRules& cr, Score alpha_score, Score beta_score) {
+    // Evaluate material and positional bonuses for the whole board at once (see eval-kernel.h)
+    eval_kernel::BoardSummary board;
+    eval_kernel::summarise(cr.squares, board);
+    return static_eval(cr, board, alpha_score, beta_score);
 }
 
-SerialEngine::Score SerialEngine::static_eval(thc::ChessRules& cr) {
-    Score total_score = 0.0f;
+SerialEngine::Score SerialEngine::static_eval(thc::ChessRules& cr, const eval_kernel::BoardSummary& board,
+                                              Score alpha_score, Score beta_score) {
+    PROFILE_ZONE(profile::STATIC_EVAL);
+    Score total_score = board.material_pst;
 
-    // Material counts
-    int white_material = 0;
-    int black_material = 0;
+    // Game phase, scaling and endgame type for this material (see material-table.h)
+    material_table::Entry material = material_table::probe(cr.material_key);
+    bool endgame = material.flags & material_table::ENDGAME;
 
-    // Piece counts for bishop pair evaluation
-    int white_bishops = 0;
-    int black_bishops = 0;
+    // Specialised endgames (KPK, KQK, KRK, KBNK, KRKP) have an evaluator of their own (see endgame.h)
+    if (material.endgame != material_table::ENDGAME_NONE) {
+        return endgame::evaluate(material.endgame, board, material.strong_white, cr.WhiteToPlay());
+    }
 
     // King positions
-    int white_king_index = -1;
-    int black_king_index = -1;
+    int white_king_index = eval_kernel::king_square(board, true);
+    int black_king_index = eval_kernel::king_square(board, false);
 
-    // Variables for pawn structure
-    std::vector<int> white_pawn_files;
-    std::vector<int> black_pawn_files;
+    // Bishop pair bonus
+    if (eval_kernel::piece_count(board, eval_kernel::WB) >= 2) total_score += 50;
+    if (eval_kernel::piece_count(board, eval_kernel::BB) >= 2) total_score -= 50;
+
+    // Stage 1: material only, give up if the positional terms cannot reach the window
+    int white_mobility_bound = mobility_bound(board, true);
+    int black_mobility_bound = mobility_bound(board, false);
+    int positional_bound = PAWN_STRUCTURE_BOUND + (endgame ? KING_ACTIVITY_BOUND : KING_SAFETY_BOUND);
+    Score upper = material_table::scale(material, total_score + positional_bound + white_mobility_bound);
+    Score lower = material_table::scale(material, total_score - positional_bound - black_mobility_bound);
+    if (upper <= alpha_score) return upper;
+    if (lower >= beta_score) return lower;
 
-    // Piece positions for mobility evaluation
-    std::vector<int> white_piece_indices;
-    std::vector<int> black_piece_indices;
+    // Pawn structure evaluation
+    total_score += evaluate_pawn_structure(board.bitboards[eval_kernel::WP], true);
+    total_score -= evaluate_pawn_structure(board.bitboards[eval_kernel::BP], false);
 
-    // Evaluate material and positional bonuses
-    for (int i = 0; i < 64; i++) {
-        char piece = cr.squares[i];
-        if (piece == ' ')
-            continue;
+    // King safety evaluation
+    total_score += evaluate_king_safety(cr, white_king_index, true, endgame);
+    total_score -= evaluate_king_safety(cr, black_king_index, false, endgame);
 
-        int index = i;
-        int flipped_index = 63 - i; // Flips the board for Black
-        int piece_value = 0;
-        float positional_bonus = 0.0f;
-
-        bool is_white = isupper(piece);
-        char lower_piece = tolower(piece);
-
-        switch (lower_piece) {
-            case 'p':
-                piece_value = 100;
-                positional_bonus = pawn_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_pawn_files.push_back(index % 8);
-                } else {
-                    black_material += piece_value;
-                    black_pawn_files.push_back(index % 8);
-                }
-                break;
-            case 'n':
-                piece_value = 320;
-                positional_bonus = knight_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_piece_indices.push_back(index);
-                } else {
-                    black_material += piece_value;
-                    black_piece_indices.push_back(index);
-                }
-                break;
-            case 'b':
-                piece_value = 330;
-                positional_bonus = bishop_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_bishops++;
-                    white_piece_indices.push_back(index);
-                } else {
-                    black_material += piece_value;
-                    black_bishops++;
-                    black_piece_indices.push_back(index);
-                }
-                break;
-            case 'r':
-                piece_value = 500;
-                positional_bonus = rook_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_piece_indices.push_back(index);
-                } else {
-                    black_material += piece_value;
-                    black_piece_indices.push_back(index);
-                }
-                break;
-            case 'q':
-                piece_value = 900;
-                positional_bonus = queen_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_material += piece_value;
-                    white_piece_indices.push_back(index);
-                } else {
-                    black_material += piece_value;
-                    black_piece_indices.push_back(index);
-                }
-                break;
-            case 'k':
-                piece_value = 20000; // High value for the King
-                positional_bonus = king_table[is_white ? index : flipped_index] / 1.0f;
-                if (is_white) {
-                    white_king_index = index;
-                } else {
-                    black_king_index = index;
-                }
-                break;
-            default:
-                break;
+    // Evaluate king activity in endgame
+    if (endgame) {
+        total_score += evaluate_king_activity(white_king_index, black_king_index, true);
+        total_score -= evaluate_king_activity(black_king_index, white_king_index, false);
+    }
+
+    // Stage 2: everything but mobility, which is the expensive term
+    upper = material_table::scale(material, total_score + white_mobility_bound);
+    lower = material_table::scale(material, total_score - black_mobility_bound);
+    if (upper <= alpha_score) return upper;
+    if (lower >= beta_score) return lower;
+
+    // Mobility evaluation
+    total_score += evaluate_mobility(cr, true);
+    total_score -= evaluate_mobility(cr, false);
+
+    // Pull the score towards a draw when the side ahead lacks the material to win
+    return material_table::scale(material, total_score);
+}
+
+/* Quiescence search. A leaf of the main search can be in the middle of an exchange, where the static evaluation
+ * means little, so captures and promotions are played on until the position is quiet. The side to move can always
+ * decline them and stand pat on the static evaluation. Moves that lose material by static exchange evaluation are
+ * not tried at all: they would almost never do better than standing pat.
+ */
+SerialEngine::Score SerialEngine::quiescence(
+    thc::ChessRules& cr,
+    int ply,
+    Score alpha_score,
+    Score beta_score,
+    const eval_kernel::BoardSummary* board
+) {
+    stats.add(search_stats::QNODES);
+    stats.add(search_stats::EVALUATED);
+    stats.reach(ply);
+
+    Score stand_pat = board ? static_eval(cr, *board, alpha_score, beta_score)
+                            : static_eval(cr, alpha_score, beta_score);
+    if (cr.white) {
+        if (stand_pat >= beta_score) return stand_pat;
+        alpha_score = std::max(alpha_score, stand_pat);
+    } else {
+        if (stand_pat <= alpha_score) return stand_pat;
+        beta_score = std::min(beta_score, stand_pat);
+    }
+
+    std::vector<thc::Move> legal_moves;
+    cr.GenLegalMoveList(legal_moves);
+
+    // Captures and promotions that do not lose material, best exchange first
+    std::vector<std::pair<int, thc::Move>> exchanges;
+    for (const auto& move : legal_moves) {
+        if (move_ordering::is_quiet(move)) continue;
+        int exchange = see::evaluate(cr, move);
+        if (exchange >= 0) {
+            exchanges.emplace_back(exchange, move);
         }
+    }
+    std::sort(exchanges.begin(), exchanges.end(), [](const std::pair<int, thc::Move>& a, const std::pair<int, thc::Move>& b) {
+        return a.first > b.first;
+    });
+
+    Score best_score = stand_pat;
+    for (auto& [exchange, move] : exchanges) {
+        cr.PushMove(move);
+        Score current_score = quiescence(cr, ply + 1, alpha_score, beta_score);
+        cr.PopMove(move);
 
-        Score square_score = piece_value + positional_bonus;
-        if (is_white) {
-            total_score += square_score;
+        if (cr.white) {
+            best_score = std::max(best_score, current_score);
+            alpha_score = std::max(alpha_score, best_score);
         } else {
-            total_score -= square_score;
+            best_score = std::min(best_score, current_score);
+            beta_score = std::min(beta_score, best_score);
+        }
+        if (beta_score <= alpha_score) {
+            break;
         }
     }
 
-    // Bishop pair bonus
-    if (white_bishops >= 2) total_score += 50;
-    if (black_bishops >= 2) total_score -= 50;
+    return best_score;
+}
 
-    // Mobility evaluation
-    total_score += evaluate_mobility(cr, true, white_piece_indices);
-    total_score -= evaluate_mobility(cr, false, black_piece_indices);
+/* Null move pruning. If the side to move could pass and still get a cutoff from a search a few plies shallower,
+ * a real move will almost always do at least as well, so the node is cut off without searching any. That fails in
+ * zugzwang, which is why the side to move must have a piece besides pawns, and two null moves in a row are not
+ * allowed. Close to the root, where a wrong cutoff costs the most, the cutoff is confirmed by a search of the real
+ * moves to the same reduced depth.
+ */
+bool SerialEngine::null_move_cutoff(thc::ChessRules& cr, bool is_white_player, int depth, int max_depth,
+                                    Score alpha_score, Score beta_score, NodeEval& node_eval) {
+    int remaining = max_depth - depth;
+    Score bound = is_white_player ? beta_score : alpha_score;
+    if (remaining < NULL_MOVE_MIN_DEPTH || !material_table::has_pieces(cr.material_key, cr.white)
+            || std::abs(bound) >= INF_SCORE / 2) {
+        return false;
+    }
 
-    // Pawn structure evaluation
-    total_score += evaluate_pawn_structure(white_pawn_files, true);
-    total_score -= evaluate_pawn_structure(black_pawn_files, false);
+    // Only worth trying when the side to move is already doing well enough
+    Score eval = evaluate_once(cr, node_eval, remaining, alpha_score, beta_score);
+    if (is_white_player ? eval < beta_score : eval > alpha_score) {
+        return false;
+    }
 
-    // King safety evaluation
+    int reduction = remaining >= NULL_MOVE_DEEP_DEPTH ? 3 : 2;
+    Score null_alpha = is_white_player ? bound - NULL_WINDOW : bound;
+    Score null_beta = is_white_player ? bound : bound + NULL_WINDOW;
+    auto cutoff = [&](Score score) {
+        return is_white_player ? score >= bound : score <= bound;
+    };
 
-    bool endgame = is_endgame(white_material, black_material);
+    cr.PushNullMove();
+    if (depth < move_ordering::MAX_PLY) {
+        ordering.played[depth].Invalid();
+    }
+    thc::Move temp_best_move;
+    Score null_score = solve_serial_engine(cr, !is_white_player, temp_best_move, depth + 1, max_depth - reduction,
+                                           null_alpha, null_beta, false);
+    cr.PopNullMove();
 
-    total_score += evaluate_king_safety(cr, white_king_index, true, endgame);
-    total_score -= evaluate_king_safety(cr, black_king_index, false, endgame);
+    if (time_limit_reached || !cutoff(null_score)) {
+        return false;
+    }
+    if (remaining < NULL_MOVE_VERIFY_DEPTH) {
+        return true;
+    }
 
-    // After calculating total material
-    
-    // Evaluate king activity in endgame
-    if (endgame) {
-        total_score += evaluate_king_activity(white_king_index, black_king_index, true);
-        total_score -= evaluate_king_activity(black_king_index, white_king_index, false);
+    Score verified_score = solve_serial_engine(cr, is_white_player, temp_best_move, depth, max_depth - reduction,
+                                               null_alpha, null_beta, false);
+    return !time_limit_reached && cutoff(verified_score);
+}
+
+/* Pruning near the horizon, all three decided by the static eval of the node, which is cheap next to a search of
+ * its moves. The margins grow with the plies left, since a deeper search has more room to change the score.
+ *
+ *   reverse futility  the eval beats the bound by a margin: assume a real move keeps it there and fail high
+ *   razoring          the eval is so far short of the bound that only captures could help: try quiescence
+ *                     instead, and believe it if it fails low too
+ *   futility          the eval plus a margin still does not reach the bound: quiet moves that give no check are
+ *                     skipped in the move loop, counted as worth eval + margin
+ *
+ * None of it is tried in check, at the root, or when a bound is a mate score.
+ */
+bool SerialEngine::horizon_cutoff(thc::ChessRules& cr, bool is_white_player, int depth, int max_depth,
+                                  Score alpha_score, Score beta_score,
+                                  NodeEval& node_eval, Score& score, bool& futile) {
+    futile = false;
+    int remaining = max_depth - depth;
+    if (remaining > HORIZON_MAX_DEPTH
+            || std::abs(alpha_score) >= INF_SCORE / 2 || std::abs(beta_score) >= INF_SCORE / 2) {
+        return false;
     }
 
+    // From the side to move's point of view, so the maximiser and minimiser share the tests
+    Score sign = is_white_player ? 1.0f : -1.0f;
+    Score eval = sign * evaluate_once(cr, node_eval, remaining, alpha_score, beta_score);
+    Score alpha = is_white_player ? alpha_score : -beta_score;
+    Score beta = is_white_player ? beta_score : -alpha_score;
+
+    if (remaining <= REVERSE_FUTILITY_MAX_DEPTH && eval - REVERSE_FUTILITY_MARGIN * remaining >= beta) {
+        score = sign * (eval - REVERSE_FUTILITY_MARGIN * remaining);
+        return true;
+    }
 
-    return total_score;
+    if (remaining <= RAZOR_MAX_DEPTH && eval + RAZOR_MARGIN[remaining] <= alpha) {
+        Score quiet_score = quiescence(cr, depth, alpha_score, beta_score);
+        if (sign * quiet_score <= alpha) {
+            score = quiet_score;
+            return true;
+        }
+    }
+
+    if (remaining <= FUTILITY_MAX_DEPTH && eval + FUTILITY_MARGIN[remaining] <= alpha) {
+        futile = true;
+        score = sign * (eval + FUTILITY_MARGIN[remaining]);
+    }
+    return false;
 }
 
-int debug_node_count = 0;
+/* The pruning tests of a node all decide on its static eval, so the first of them to need it evaluates the node
+ * and the rest reuse the value. The window is widened by the widest margin a test compares the eval against with
+ * this many plies left (null move pruning compares it with the bound itself), so a lazy exit never changes one of
+ * their decisions.
+ */
+SerialEngine::Score SerialEngine::evaluate_once(thc::ChessRules& cr, NodeEval& node_eval, int remaining,
+                                                Score alpha_score, Score beta_score) {
+    if (!node_eval.known) {
+        Score margin = 0.0f;
+        if (remaining <= REVERSE_FUTILITY_MAX_DEPTH) {
+            margin = std::max(margin, REVERSE_FUTILITY_MARGIN * remaining);
+        }
+        if (remaining <= FUTILITY_MAX_DEPTH) {
+            margin = std::max(margin, FUTILITY_MARGIN[remaining]);
+        }
+        if (remaining <= RAZOR_MAX_DEPTH) {
+            margin = std::max(margin, RAZOR_MARGIN[remaining]);
+        }
+        node_eval.value = static_eval(cr, alpha_score - margin, beta_score + margin);
+        node_eval.known = true;
+    }
+    return node_eval.value;
+}
 
-thc::Move SerialEngine::solve(thc::ChessRules& cr, bool is_white_player) {
+search_limits::SearchResult SerialEngine::solve(thc::ChessRules& cr, bool is_white_player,
+                                                const search_limits::SearchLimits& limits) {
     this->time_limit_reached = false;
     this->start_time = std::chrono::steady_clock::now();
-
-    thc::Move best_move_so_far;
+    this->timer.start(limits, cr.white, DEFAULT_TIME_LIMIT_SECONDS);
+    this->node_limit = limits.nodes;
+    this->nodes_searched = 0;
+    int depth_limit = limits.max_depth(DEFAULT_DEPTH);
+    profile::begin();
+    perf_counters::attach(0);
+    std::vector<perf_counters::Values> search_counters = perf_counters::read();
+
+    search_limits::SearchResult result;
     bool move_found = false;
+    bool mate_found = false;
 
-    for (int current_depth = 1; current_depth <= MAX_DEPTH; ++current_depth) {
-        debug_node_count = 0;
-        if (time_limit_reached) {
+    ordering.clear();
+
+    // Keep the root move order of the last search if this is the same position, else start from score_move
+    if (!root_list.begin(cr)) {
+        std::vector<thc::Move> legal_moves;
+        cr.GenLegalMoveList(legal_moves);
+        std::vector<std::pair<float, thc::Move>> scored_moves;
+        for (const auto& move : legal_moves) {
+            scored_moves.emplace_back(score_move(move, cr, 0), move);
+        }
+        std::stable_sort(scored_moves.begin(), scored_moves.end(), [](const std::pair<float, thc::Move>& a, const std::pair<float, thc::Move>& b) {
+            return a.first > b.first;
+        });
+        root_list.reset(scored_moves);
+    }
+
+    for (int current_depth = 1; current_depth <= depth_limit && !mate_found; ++current_depth) {
+        stats.clear();
+        // Past the soft limit an iteration would rarely finish in time
+        if (time_limit_reached || !timer.time_for_iteration()) {
             break; 
         }
 
         thc::Move current_best_move;
+        std::vector<perf_counters::Values> iteration_counters = perf_counters::read();
         Score current_score = solve_serial_engine(
             cr,
             is_white_player,
@@ -512,38 +621,82 @@ thc::Move SerialEngine::solve(thc::ChessRules& cr, bool is_white_player) {
             -INF_SCORE,
             INF_SCORE
         );
+        perf_counters::Values hardware = perf_counters::total(perf_counters::difference(perf_counters::read(), iteration_counters));
 
+        nodes_searched += stats[search_stats::EVALUATED];
         if (time_limit_reached) {
             break; 
         }
 
-        best_move_so_far = current_best_move;
+        result.best_move = current_best_move;
+        result.score = current_score;
+        result.depth = current_depth;
+        timer.iteration_complete(current_best_move);
         move_found = true;
 
+        // A mate within the depth searched is as short as the search can find, deeper iterations would only
+        // prove it again. It is proven already: no move is pruned at a node whose best score is still a mate, so
+        // every defence of the mated side was searched.
+        mate_found = std::abs(current_score) >= INF_SCORE - current_depth;
+        root_list.complete(cr.white);
+        result.pv = root_list.principal_variation();
+
         // Debug output (record this data as metric for engine performance)
         auto current_time = std::chrono::steady_clock::now();
         std::chrono::duration<double> elapsed_seconds = current_time - start_time;
         std::cout << "Depth: " <<  current_depth 
         << ", Score: " << (current_score / 100.0f) 
         << ", Time: " << elapsed_seconds.count() << "s" 
-        << ", Nodes Evaluated = " << debug_node_count 
-        << ", knps: " << (debug_node_count/1000.0) / elapsed_seconds.count() 
+        << ", Nodes Evaluated = " << stats[search_stats::EVALUATED] 
+        << ", knps: " << (stats[search_stats::EVALUATED]/1000.0) / elapsed_seconds.count() 
+        << ", First-move cutoffs: " << move_ordering::first_move_cutoff_rate(stats[search_stats::FIRST_MOVE_CUTOFFS], stats[search_stats::CUTOFFS]) << "%"
+        << ", Quiescence nodes: " << stats[search_stats::QNODES]
+        << ", Tablebase hits: " << stats[search_stats::TABLEBASE_HITS]
         << std::endl;
+        if (perf_counters::enabled()) {
+            std::cout << "Hardware: " << perf_counters::describe(hardware, stats[search_stats::EVALUATED]) << std::endl;
+        }
+
+        if (telemetry::enabled()) {
+            telemetry::Iteration record;
+            record.engine = "serial";
+            record.depth = current_depth;
+            record.score = current_score;
+            record.pv = result.pv;
+            record.seconds = elapsed_seconds.count();
+            record.branching_factor = timer.branching_factor();
+            record.counters = stats;
+            record.workers.assign(1, stats[search_stats::EVALUATED]);
+            record.hardware = hardware;
+            telemetry::iteration(record);
+        }
     }
 
-    if (move_found) {
-        return best_move_so_far;
-    } else {
+    root_list.end(cr);
+    profile::report(profile::collect());
+    if (perf_counters::enabled()) {
+        perf_counters::Values hardware = perf_counters::total(perf_counters::difference(perf_counters::read(), search_counters));
+        std::cout << "Hardware, whole search: " << perf_counters::describe(hardware, nodes_searched) << std::endl;
+    }
+
+    if (!move_found) {
         // If no move was found (unlikely), generate a random legal move
         std::vector<thc::Move> legal_moves;
         cr.GenLegalMoveList(legal_moves);
         if (!legal_moves.empty()) {
-            return legal_moves[0];
+            result.best_move = legal_moves[0];
         } else {
             // No legal moves, return a default move
-            return thc::Move();
+            result.best_move = thc::Move();
         }
+        result.pv.assign(1, result.best_move);
     }
+
+    std::chrono::duration<double> elapsed_seconds = std::chrono::steady_clock::now() - start_time;
+    result.nodes = nodes_searched;
+    result.workers.assign(1, nodes_searched);
+    result.time = elapsed_seconds.count();
+    return result;
 }
 
 SerialEngine::Score SerialEngine::solve_serial_engine(
@@ -553,21 +706,29 @@ SerialEngine::Score SerialEngine::solve_serial_engine(
     int depth,
     int max_depth,
     Score alpha_score,
-    Score beta_score
+    Score beta_score,
+    bool allow_null_move,
+    const eval_kernel::BoardSummary* leaf_board
 ) {
+    ordering.enter(depth);
+    stats.add(search_stats::NODES);
+    stats.reach(depth);
+
     // Check if time limit has been reached
     if (time_limit_reached) {
         return 0.0f;
     }
 
-    // Check time at certain intervals to minimize performance impact (we do mod 5)
-    if (depth % 5 == 0) { 
-        auto current_time = std::chrono::steady_clock::now();
-        std::chrono::duration<double> elapsed_seconds = current_time - start_time;
-        if (elapsed_seconds.count() >= TIME_LIMIT_SECONDS) {
-            time_limit_reached = true;
-            return 0.0f;
-        }
+    // Check the node limit everywhere, it only costs a comparison
+    if (node_limit > 0 && nodes_searched + stats[search_stats::EVALUATED] >= node_limit) {
+        time_limit_reached = true;
+        return 0.0f;
+    }
+
+    // The time manager reads the clock every few thousand nodes
+    if (timer.poll()) {
+        time_limit_reached = true;
+        return 0.0f;
     }
 
     thc::DRAWTYPE draw_reason;
@@ -575,24 +736,72 @@ SerialEngine::Score SerialEngine::solve_serial_engine(
         return 0.0f;
     }
 
+    // Mate distance pruning. The side to move can be mated here at the soonest, and can mate at the next ply at
+    // the soonest, which bounds every score below this node. If the window lies outside those bounds, a shorter
+    // mate has been found elsewhere and the node cannot change the result.
+    if (depth > 0) {
+        Score lowest = cr.white ? -(INF_SCORE - depth) : -(INF_SCORE - depth - 1);
+        Score highest = cr.white ? INF_SCORE - depth - 1 : INF_SCORE - depth;
+        alpha_score = std::max(alpha_score, lowest);
+        beta_score = std::min(beta_score, highest);
+        if (alpha_score >= beta_score) {
+            return alpha_score;
+        }
+    }
+
     // Check for checkmate or stalemate
     thc::TERMINAL terminal;
     if (cr.Evaluate(terminal)) {
         if (terminal == thc::TERMINAL_WCHECKMATE) {
-            debug_node_count++;
+            stats.add(search_stats::EVALUATED);
             return -INF_SCORE + depth; // White is checkmated
         } else if (terminal == thc::TERMINAL_BCHECKMATE) {
-            debug_node_count++;
+            stats.add(search_stats::EVALUATED);
             return INF_SCORE - depth; // Black is checkmated
         } else if (terminal == thc::TERMINAL_WSTALEMATE || terminal == thc::TERMINAL_BSTALEMATE) {
-            debug_node_count++;
+            stats.add(search_stats::EVALUATED);
             return 0.0f; // Stalemate is a draw
         }
     }
 
+    // Exact result from the endgame tablebases once few enough pieces are left
+    Score tablebase_score;
+    if (depth > 0 && probe_tablebase(cr, depth, tablebase_score)) {
+        stats.add(search_stats::EVALUATED);
+        stats.add(search_stats::TABLEBASE_HITS);
+        return tablebase_score;
+    }
+
+    // Nothing to gain from searching a king and pawn vs king ending the bitbase says is drawn. A won one is searched
+    // on, since which moves make progress towards promotion is for the search to find (see endgame.cpp).
+    if (depth > 0 && material_table::probe(cr.material_key).endgame == material_table::ENDGAME_KPK
+            && static_eval(cr) == 0.0f) {
+        stats.add(search_stats::EVALUATED);
+        stats.add(search_stats::TABLEBASE_HITS);
+        return 0.0f;
+    }
+
     if (depth == max_depth) {
-        debug_node_count++;
-        return static_eval(cr);
+        return quiescence(cr, depth, alpha_score, beta_score, leaf_board);
+    }
+
+    bool in_check = cr.AttackedPiece(cr.white ? cr.wking_square : cr.bking_square);
+
+    // Evaluated by the first pruning test that needs it (see evaluate_once)
+    NodeEval node_eval;
+    bool may_prune = depth > 0 && !in_check;
+
+    Score horizon_score = 0.0f;
+    bool futile = false;
+    if (may_prune && horizon_cutoff(cr, is_white_player, depth, max_depth, alpha_score, beta_score, node_eval,
+                                    horizon_score, futile)) {
+        return horizon_score;
+    }
+
+    if (allow_null_move && may_prune
+            && null_move_cutoff(cr, is_white_player, depth, max_depth, alpha_score, beta_score, node_eval)) {
+        stats.add(search_stats::NULL_MOVE_CUTOFFS);
+        return is_white_player ? beta_score : alpha_score;
     }
 
     std::vector<thc::Move> legal_moves;
@@ -603,25 +812,126 @@ SerialEngine::Score SerialEngine::solve_serial_engine(
         return 0.0f;
     }
 
-    // Assign scores to moves
+    // Assign scores to moves. The root takes them in the order of its move list instead (see root-moves.h).
     std::vector<std::pair<float, thc::Move>> scored_moves;
-    for (const auto& move : legal_moves) {
-        float score = score_move(move, cr);
-        scored_moves.emplace_back(score, move);
-    }
+    if (depth == 0) {
+        for (const auto& root_move : root_list.moves()) {
+            scored_moves.emplace_back(0.0f, root_move.move);
+        }
+    } else {
+        PROFILE_ZONE(profile::MOVE_ORDERING);
+        for (const auto& move : legal_moves) {
+            float score = score_move(move, cr, depth);
+            scored_moves.emplace_back(score, move);
+        }
 
-    // Sort moves by descending score using a custom comparator
-    std::sort(scored_moves.begin(), scored_moves.end(), [](const std::pair<float, thc::Move>& a, const std::pair<float, thc::Move>& b) {
-        return a.first > b.first;
-    });
+        // Sort moves by descending score using a custom comparator
+        std::sort(scored_moves.begin(), scored_moves.end(), [](const std::pair<float, thc::Move>& a, const std::pair<float, thc::Move>& b) {
+            return a.first > b.first;
+        });
+    }
 
     Score best_score = is_white_player ? -INF_SCORE : INF_SCORE;
+    int remaining = max_depth - depth;
+    bool white = cr.white;
+
+    // Late quiet moves that give no check are pruned near the leaves, and reduced further up. Both tests take
+    // the child's move already pushed, to see whether it gives check.
+    auto is_late = [&](size_t i, const thc::Move& move, bool quiet, bool gives_check) {
+        return depth > 0 && quiet && !in_check && !gives_check && i >= late_moves::FULL_DEPTH_MOVES
+               && !ordering.is_killer(move, depth);
+    };
+    // No move is pruned while the best score is still a mate: until some move escapes the mate, a pruned move
+    // may be the only one that does, and the node would return a mate it has not proven. As best_score starts
+    // at a mate against the side to move, the first move is always searched.
+    auto is_pruned = [&](size_t i, const thc::Move& move, bool quiet, bool good_history, bool gives_check) {
+        return ((futile && quiet && !gives_check)
+                || (is_late(i, move, quiet, gives_check) && remaining <= late_moves::PRUNING_MAX_DEPTH
+                    && !good_history && (int)i >= late_moves::pruning_limit(remaining)))
+               && std::abs(best_score) < MATE_BOUND;
+    };
+
+    // A ply above the leaves, every child searched is a leaf (nothing is reduced with one ply left), and its
+    // quiescence search starts from its static eval. So the children the loop will search are summarised
+    // together from this node's summary, a batch at a time. Killers and history do not change during the loop
+    // until the cutoff that ends it, so the pruning tests decide as in the loop unless the best score has since
+    // left or entered the mates. A child planned then is summarised for nothing, or searched without one.
+    LeafBatch leaves;
+    auto plan_leaves = [&](size_t from) {
+        if (!leaves.board_known) {
+            eval_kernel::summarise(cr.squares, leaves.board);
+            leaves.board_known = true;
+        }
+        eval_kernel::ChildBatch batch;
+        size_t k = from;
+        for (; k < scored_moves.size() && batch.count < eval_kernel::BATCH_SIZE; k++) {
+            thc::Move& move = scored_moves[k].second;
+            bool quiet = move_ordering::is_quiet(move);
+            bool pruned = false;
+            if (quiet && (futile || is_late(k, move, quiet, false))) {   // else giving check changes nothing
+                bool good_history = ordering.history_score(move, white) >= late_moves::GOOD_HISTORY;
+                cr.PushMove(move);
+                bool gives_check = cr.AttackedPiece(cr.white ? cr.wking_square : cr.bking_square);
+                pruned = is_pruned(k, move, quiet, good_history, gives_check);
+                cr.PopMove(move);
+            }
+            if (!pruned) {
+                leaves.index[batch.count] = k;
+                eval_kernel::add_child(batch, cr.squares, move);
+            }
+        }
+        leaves.planned = k;
+        leaves.count = batch.count;
+        leaves.next = 0;
+        eval_kernel::summarise_children(leaves.board, batch, leaves.children);
+    };
 
     for (size_t i = 0; i < scored_moves.size(); i++) {
         auto& move = scored_moves[i].second; // Ensure 'move' is non-const
 
+        // A capture that loses material is searched a ply shallower, and again at full depth only if it
+        // turns out better than the moves before it
+        int reduction = 0;
+        if (remaining >= BAD_CAPTURE_REDUCTION_DEPTH && move.capture != ' ' && !in_check
+            && see::evaluate(cr, move) < 0) {
+            reduction = 1;
+        }
+        bool quiet = move_ordering::is_quiet(move);
+        bool good_history = quiet && ordering.history_score(move, white) >= late_moves::GOOD_HISTORY;
+
+        const eval_kernel::BoardSummary* leaf = nullptr;
+        if (remaining == 1) {
+            if (i >= leaves.planned) {
+                plan_leaves(i);
+            }
+            if (leaves.next < leaves.count && leaves.index[leaves.next] == i) {
+                leaf = &leaves.children[leaves.next++];
+            }
+        }
+
         // Push the move
+        uint64_t nodes_before = ordering.nodes;
         cr.PushMove(move);
+        if (depth < move_ordering::MAX_PLY) {
+            ordering.played[depth] = move;
+        }
+
+        bool gives_check = cr.AttackedPiece(cr.white ? cr.wking_square : cr.bking_square);
+        if (is_pruned(i, move, quiet, good_history, gives_check)) {
+            if (futile && quiet && !gives_check) {
+                best_score = is_white_player ? std::max(best_score, horizon_score)
+                                             : std::min(best_score, horizon_score);
+            }
+            cr.PopMove(move);
+            stats.add(search_stats::PRUNED_MOVES);
+            continue;
+        }
+
+        bool late = is_late(i, move, quiet, gives_check);
+        if (late && remaining >= late_moves::REDUCTION_MIN_DEPTH) {
+            reduction = std::max(late_moves::reduction(remaining, i) - good_history, 0);
+        }
+        reduction = std::min(reduction, remaining - 1);
 
         // Recurse
         thc::Move temp_best_move;
@@ -630,10 +940,23 @@ SerialEngine::Score SerialEngine::solve_serial_engine(
             !is_white_player,
             temp_best_move,
             depth + 1,
-            max_depth,
+            max_depth - reduction,
             alpha_score,
-            beta_score
+            beta_score,
+            true,
+            leaf
         );
+        if (reduction > 0 && (is_white_player ? current_score > alpha_score : current_score < beta_score)) {
+            current_score = solve_serial_engine(
+                cr,
+                !is_white_player,
+                temp_best_move,
+                depth + 1,
+                max_depth,
+                alpha_score,
+                beta_score
+            );
+        }
 
         // Pop the move
         cr.PopMove(move);
@@ -643,27 +966,38 @@ SerialEngine::Score SerialEngine::solve_serial_engine(
             return 0.0f;
         }
 
+        if (depth == 0) {
+            root_list.record(move, current_score, ordering.nodes - nodes_before);
+        }
+
         if (is_white_player) {
             if (current_score > best_score) {
                 best_score = current_score;
+                ordering.update_pv(move, depth);
                 if (depth == 0) {
                     best_move = move;
+                    root_list.record_pv(ordering.pv[0], ordering.pv_length[0]);
                 }
                 alpha_score = std::max(alpha_score, best_score);
             }
             if (beta_score <= alpha_score) {
-                
+                stats.add_cutoff(i);
+                ordering.update_cutoff(move, depth, cr.white, max_depth - depth);
                 break; // Beta cutoff
             }
         } else {
             if (current_score < best_score) {
                 best_score = current_score;
+                ordering.update_pv(move, depth);
                 if (depth == 0) {
                     best_move = move;
+                    root_list.record_pv(ordering.pv[0], ordering.pv_length[0]);
                 }
                 beta_score = std::min(beta_score, best_score);
             }
             if (beta_score <= alpha_score) {
+                stats.add_cutoff(i);
+                ordering.update_cutoff(move, depth, cr.white, max_depth - depth);
                 break; // Alpha cutoff
             }
         }
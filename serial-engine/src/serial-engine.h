@@ -2,6 +2,20 @@
 #define SERIAL_ENGINE_H
 
 #include "thc.h"      // Include the THC library header
+#include "search-limits.h"
+#include "time-manager.h"
+#include "eval-kernel.h"
+#include "material-table.h"
+#include "endgame.h"
+#include "tablebase.h"
+#include "move-ordering.h"
+#include "see.h"
+#include "late-moves.h"
+#include "root-moves.h"
+#include "search-stats.h"
+#include "telemetry.h"
+#include "profile.h"
+#include "perf-counters.h"
 #include <chrono>
 #include <atomic>
 #include <vector>     // For std::vector
@@ -11,11 +25,42 @@ public:
     using Score = float;
 
     static constexpr Score INF_SCORE = 1000000.0f;
-    static constexpr int MAX_DEPTH = 7;
-    static constexpr int TIME_LIMIT_SECONDS = 60; // Time limit in seconds
+    static constexpr int TABLEBASE_MATE_PLIES = 256; // distance assumed for a tablebase win with no .dtm file
+    static constexpr int DEFAULT_DEPTH = 7; // searched when the limits set no depth
+    static constexpr int BAD_CAPTURE_REDUCTION_DEPTH = 3; // losing captures are reduced with this many plies left
+    static constexpr int NULL_MOVE_MIN_DEPTH = 3;         // null moves are tried with at least this many plies left
+    static constexpr int NULL_MOVE_DEEP_DEPTH = 6;        // from here the null move search is 3 plies shallower, not 2
+    static constexpr int NULL_MOVE_VERIFY_DEPTH = 5;      // from here a null move cutoff is verified
+    static constexpr Score NULL_WINDOW = 1.0f;
+    // Scores this far from zero are mates, found by search or in the tablebases
+    static constexpr Score MATE_BOUND = INF_SCORE - move_ordering::MAX_PLY - TABLEBASE_MATE_PLIES;
 
-    // Solve function to find the best move
-    thc::Move solve(thc::ChessRules& cr, bool is_white_player);
+    // Pruning by static eval near the horizon, margins in centipawns indexed by plies left
+    static constexpr int FUTILITY_MAX_DEPTH = 3;          // quiet moves are pruned with up to this many plies left
+    static constexpr Score FUTILITY_MARGIN[FUTILITY_MAX_DEPTH + 1] = { 0.0f, 200.0f, 350.0f, 500.0f };
+    static constexpr int REVERSE_FUTILITY_MAX_DEPTH = 3;  // nodes fail high on the eval with up to this many plies left
+    static constexpr Score REVERSE_FUTILITY_MARGIN = 120.0f; // per ply left
+    static constexpr int RAZOR_MAX_DEPTH = 2;             // nodes drop into quiescence with up to this many plies left
+    static constexpr Score RAZOR_MARGIN[RAZOR_MAX_DEPTH + 1] = { 0.0f, 300.0f, 500.0f };
+    static constexpr int HORIZON_MAX_DEPTH = 3;           // the most plies left at which any of the three is tried
+    static constexpr int DEFAULT_TIME_LIMIT_SECONDS = 60; // Time limit in seconds, when the limits set none
+
+    // Solve function to find the best move within the given limits, with its score and principal variation
+    search_limits::SearchResult solve(thc::ChessRules& cr, bool is_white_player,
+                                      const search_limits::SearchLimits& limits);
+
+    // Solve function to find the best move, at the default depth and time limit
+    thc::Move solve(thc::ChessRules& cr, bool is_white_player) {
+        return solve(cr, is_white_player, search_limits::SearchLimits()).best_move;
+    }
+
+    // From another thread, for a search running in the background (search-thread.h): stop it, allow the next
+    // one to run, or give a search that has been pondering these limits from now on
+    void stop() { timer.stop(); }
+    void clear_stop() { timer.clear_stop(); }
+    void ponder_hit(const search_limits::SearchLimits& limits, bool white) {
+        timer.ponder_hit(limits, white, DEFAULT_TIME_LIMIT_SECONDS);
+    }
 
 private:
     // Recursive search function with alpha-beta pruning and iterative deepening
@@ -26,35 +71,90 @@ private:
         int depth,
         int max_depth,
         Score alpha_score,
-        Score beta_score
+        Score beta_score,
+        bool allow_null_move = true,
+        const eval_kernel::BoardSummary* leaf_board = nullptr   // the node's summary, when it is a leaf
     );
 
-    // Static evaluation function
-    Score static_eval(thc::ChessRules& cr);
+    // Static eval of a node, shared by its pruning tests
+    struct NodeEval {
+        bool known = false;
+        Score value = 0.0f;
+    };
+
+    // The children of a node one ply above the leaves, summarised a batch at a time: each batch holds the next
+    // children its move loop will search
+    struct LeafBatch {
+        bool board_known = false;
+        eval_kernel::BoardSummary board;                        // the node's own summary
+        size_t planned = 0;                                     // children planned so far
+        int count = 0;                                          // in the batch under way
+        int next = 0;                                           // the first of them not yet searched
+        size_t index[eval_kernel::BATCH_SIZE];                  // their move numbers
+        eval_kernel::BoardSummary children[eval_kernel::BATCH_SIZE];
+    };
+
+    // Null move pruning: whether passing the move still leaves the side to move with a cutoff
+    bool null_move_cutoff(thc::ChessRules& cr, bool is_white_player, int depth, int max_depth,
+                          Score alpha_score, Score beta_score, NodeEval& node_eval);
+
+    // Reverse futility pruning and razoring: true if the node need not be searched, with its score in score.
+    // Otherwise futile tells whether quiet moves cannot reach the bound, and score is then what they are worth.
+    // Both evaluate the node through node_eval, so it is evaluated once at most.
+    bool horizon_cutoff(thc::ChessRules& cr, bool is_white_player, int depth, int max_depth,
+                        Score alpha_score, Score beta_score, NodeEval& node_eval, Score& score, bool& futile);
+
+    // The node's static eval for the pruning tests above, computed by the first of them to need it
+    Score evaluate_once(thc::ChessRules& cr, NodeEval& node_eval, int remaining, Score alpha_score, Score beta_score);
+
+    // Captures and promotions from a leaf of the main search, at ply, until the position is quiet. board is the
+    // leaf's summary when the caller has it.
+    Score quiescence(thc::ChessRules& cr, int ply, Score alpha_score, Score beta_score,
+                     const eval_kernel::BoardSummary* board = nullptr);
 
-    // Helper function to score moves for move ordering
-    float score_move(const thc::Move& move, thc::ChessRules& cr);
+    // Static evaluation function. Stops early once the score is known to fall outside (alpha_score, beta_score).
+    Score static_eval(thc::ChessRules& cr, Score alpha_score = -INF_SCORE, Score beta_score = INF_SCORE);
+    Score static_eval(thc::ChessRules& cr, const eval_kernel::BoardSummary& board,
+                      Score alpha_score = -INF_SCORE, Score beta_score = INF_SCORE);
+
+    // Helper function to score moves for move ordering, for a node at the given ply
+    float score_move(const thc::Move& move, thc::ChessRules& cr, int ply);
 
     // **Add the missing function declarations here**
 
     // Function to evaluate mobility
-    int evaluate_mobility(thc::ChessRules& cr, bool is_white, const std::vector<int>& piece_indices);
+    int evaluate_mobility(thc::ChessRules& cr, bool is_white);
 
     // Function to evaluate pawn structure
-    int evaluate_pawn_structure(const std::vector<int>& pawn_files, bool is_white);
+    int evaluate_pawn_structure(uint64_t pawns, bool is_white);
 
     // Function to evaluate king safety
     int evaluate_king_safety(thc::ChessRules& cr, int king_index, bool is_white, bool endgame);
 
-    // Function to detect endgame phase
-    bool is_endgame(int white_material, int black_material);
-
     // Function to evaluate king activity in endgame
     int evaluate_king_activity(int own_king_index, int opponent_king_index, bool is_white);
 
+    // Score a position from the endgame tablebases, false if they do not cover it
+    bool probe_tablebase(const thc::ChessRules& cr, int depth, Score& score);
+
+    // Upper bound on evaluate_mobility for one side, used by lazy evaluation
+    int mobility_bound(const eval_kernel::BoardSummary& board, bool is_white);
+
+    // Killer, history and countermove tables
+    move_ordering::Tables ordering;
+
+    // What the iteration under way has searched
+    search_stats::Counters stats;
+
+    // Root moves in search order, kept across iterations and calls to solve()
+    root_moves::RootMoves root_list;
+
     // Time management variables
     std::chrono::steady_clock::time_point start_time;
     std::atomic<bool> time_limit_reached;
+    time_manager::TimeManager timer;
+    uint64_t node_limit;        // 0 for none
+    uint64_t nodes_searched;    // in the iterations completed so far
 };
 
 #endif // SERIAL_ENGINE_H
@@ -0,0 +1,340 @@
+/*
+ *  tablebase
+ *
+ *  See tablebase.h. Tables are mapped read-only and shared between threads (and, through the page cache,
+ *  between MPI ranks on one host); nothing is copied into memory up front.
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_map>
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "tablebase.h"
+
+namespace tablebase {
+
+namespace {
+
+// Each side's counts in table order, with the letter used in names and on the board
+const thc::MATERIAL_FIELD WHITE_FIELDS[5] = { thc::MATERIAL_WQ, thc::MATERIAL_WR, thc::MATERIAL_WB,
+                                              thc::MATERIAL_WN, thc::MATERIAL_WP };
+const thc::MATERIAL_FIELD BLACK_FIELDS[5] = { thc::MATERIAL_BQ, thc::MATERIAL_BR, thc::MATERIAL_BB,
+                                              thc::MATERIAL_BN, thc::MATERIAL_BP };
+const char PIECE_LETTERS[5] = { 'Q', 'R', 'B', 'N', 'P' };
+const int PIECE_WEIGHTS[5] = { 9, 5, 3, 3, 1 };
+
+// Squares as in thc: a8 = 0, h1 = 63
+int file_of(int sq) { return sq & 7; }
+int rank_of(int sq) { return 7 - (sq >> 3); }    // 0 for the first rank
+
+// The 10 squares of the a1-d1-d4 triangle, numbered 0-9 (-1 elsewhere)
+struct Triangle {
+    int number[64];
+    int square[10];
+
+    Triangle() {
+        int n = 0;
+        for (int sq = 0; sq < 64; sq++) number[sq] = -1;
+        for (int file = 0; file < 4; file++) {
+            for (int rank = 0; rank <= file; rank++) {
+                int sq = (7 - rank) * 8 + file;
+                number[sq] = n;
+                square[n++] = sq;
+            }
+        }
+    }
+};
+
+const Triangle triangle;
+
+bool is_pawn(char piece) {
+    return piece == 'P' || piece == 'p';
+}
+
+int transposed(int sq) { return (7 - file_of(sq)) * 8 + rank_of(sq); }     // mirrored in the a1-h8 diagonal
+
+// Number of piece squares already in the canonical area. Pieces of the same kind are taken in square order, so
+// it does not matter which of them is on which square.
+uint64_t pack(const Layout& layout, int* squares) {
+    for (int i = 3; i < layout.count; i++) {
+        for (int j = i; j > 2 && layout.pieces[j - 1] == layout.pieces[j] && squares[j - 1] > squares[j]; j--) {
+            std::swap(squares[j - 1], squares[j]);
+        }
+    }
+
+    int wk = squares[0];
+    uint64_t n = layout.pawns ? (uint64_t)((wk >> 3) * 4 + file_of(wk)) : (uint64_t)triangle.number[wk];
+    n = n * 64 + squares[1];
+    for (int i = 2; i < layout.count; i++) {
+        n = is_pawn(layout.pieces[i]) ? n * 48 + (squares[i] - 8) : n * 64 + squares[i];
+    }
+    return n;
+}
+
+// Position number from piece squares in layout order, for the side to move. Positions that are the same up to
+// symmetry get the same number.
+uint64_t number(const Layout& layout, int* squares, bool white_to_move) {
+    // Bring the white king into its canonical area, moving every other piece with it
+    int wk = squares[0];
+    int mirror = file_of(wk) > 3 ? 7 : 0;
+    bool transpose = false;
+    if (!layout.pawns) {
+        if (rank_of(wk) > 3) mirror ^= 56;
+        wk ^= mirror;
+        transpose = rank_of(wk) > file_of(wk);
+    }
+    for (int i = 0; i < layout.count; i++) {
+        int sq = squares[i] ^ mirror;
+        squares[i] = transpose ? transposed(sq) : sq;
+    }
+
+    uint64_t n = pack(layout, squares);
+    // A king on the a1-d4 diagonal is in the triangle either way round: take the lower number of the two
+    if (!layout.pawns && rank_of(squares[0]) == file_of(squares[0])) {
+        int other[MAX_PIECES];
+        for (int i = 0; i < layout.count; i++) other[i] = transposed(squares[i]);
+        n = std::min(n, pack(layout, other));
+    }
+    return white_to_move ? n : n + layout.positions;
+}
+
+struct Table {
+    Layout layout;
+    const uint8_t* wdl;
+    const uint8_t* dtm;     // nullptr if there is no .dtm file
+};
+
+std::unordered_map<uint64_t, Table> tables;
+int largest = 0;
+
+// Map a table file and check its header, returns the data following the header
+const uint8_t* map_file(const std::string& path, const char* magic, FileHeader& header) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+    struct stat st;
+    void* base = MAP_FAILED;
+    if (fstat(fd, &st) == 0 && (size_t)st.st_size >= sizeof(FileHeader)) {
+        base = mmap(nullptr, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    }
+    close(fd);
+    if (base == MAP_FAILED) {
+        return nullptr;
+    }
+
+    std::memcpy(&header, base, sizeof(FileHeader));
+    bool wdl = std::memcmp(magic, WDL_MAGIC, sizeof(WDL_MAGIC)) == 0;
+    uint64_t entries = 2 * header.positions;
+    size_t expected = sizeof(FileHeader) + (wdl ? (entries + 3) / 4 : entries);
+    if (std::memcmp(header.magic, magic, sizeof(header.magic)) != 0 || (size_t)st.st_size != expected) {
+        munmap(base, st.st_size);
+        return nullptr;
+    }
+    return (const uint8_t*)base + sizeof(FileHeader);
+}
+
+} // namespace
+
+uint64_t swap_colours(uint64_t key) {
+    return (key & MATERIAL_WHITE_MASK) << thc::MATERIAL_BP | (key & MATERIAL_BLACK_MASK) >> thc::MATERIAL_BP;
+}
+
+// The side with more material (by weight, then by count of the more valuable pieces) is white in tables
+bool is_canonical(uint64_t key) {
+    int white = 0, black = 0;
+    for (int i = 0; i < 5; i++) {
+        white += thc::material_count(key, WHITE_FIELDS[i]) * PIECE_WEIGHTS[i];
+        black += thc::material_count(key, BLACK_FIELDS[i]) * PIECE_WEIGHTS[i];
+    }
+    if (white != black) {
+        return white > black;
+    }
+    for (int i = 0; i < 5; i++) {
+        int w = thc::material_count(key, WHITE_FIELDS[i]);
+        int b = thc::material_count(key, BLACK_FIELDS[i]);
+        if (w != b) return w > b;
+    }
+    return true;
+}
+
+int piece_count(uint64_t key) {
+    int count = 2;
+    for (int i = 0; i < 5; i++) {
+        count += thc::material_count(key, WHITE_FIELDS[i]) + thc::material_count(key, BLACK_FIELDS[i]);
+    }
+    return count;
+}
+
+std::string name(uint64_t key) {
+    std::string s = "K";
+    for (int i = 0; i < 5; i++) s.append(thc::material_count(key, WHITE_FIELDS[i]), PIECE_LETTERS[i]);
+    s += "vK";
+    for (int i = 0; i < 5; i++) s.append(thc::material_count(key, BLACK_FIELDS[i]), PIECE_LETTERS[i]);
+    return s;
+}
+
+Layout layout(uint64_t key) {
+    Layout layout = {};
+    layout.key = key;
+    layout.pieces[layout.count++] = 'K';
+    layout.pieces[layout.count++] = 'k';
+    for (int side = 0; side < 2; side++) {
+        for (int i = 0; i < 5; i++) {
+            int n = thc::material_count(key, side == 0 ? WHITE_FIELDS[i] : BLACK_FIELDS[i]);
+            for (int j = 0; j < n; j++) {
+                layout.pieces[layout.count++] = side == 0 ? PIECE_LETTERS[i] : (char)(PIECE_LETTERS[i] - 'A' + 'a');
+            }
+        }
+    }
+
+    layout.pawns = thc::material_count(key, thc::MATERIAL_WP) + thc::material_count(key, thc::MATERIAL_BP) > 0;
+    layout.positions = layout.pawns ? 32 * 64 : 10 * 64;
+    for (int i = 2; i < layout.count; i++) {
+        layout.positions *= is_pawn(layout.pieces[i]) ? 48 : 64;
+    }
+    return layout;
+}
+
+uint64_t index(const Layout& layout, const thc::ChessRules& cr, bool flip) {
+    int squares[MAX_PIECES];
+    bool found[MAX_PIECES] = {};
+
+    // With flip each piece plays for the other colour, from the square mirrored top to bottom
+    for (int sq = 0; sq < 64; sq++) {
+        char piece = cr.squares[sq];
+        if (piece == ' ') continue;
+        if (flip) {
+            piece = (piece >= 'a') ? (char)(piece - 'a' + 'A') : (char)(piece - 'A' + 'a');
+        }
+        for (int i = 0; i < layout.count; i++) {
+            if (!found[i] && layout.pieces[i] == piece) {
+                found[i] = true;
+                squares[i] = flip ? sq ^ 56 : sq;
+                break;
+            }
+        }
+    }
+    return number(layout, squares, cr.white != flip);
+}
+
+bool decode(const Layout& layout, uint64_t index, thc::ChessRules& cr) {
+    bool white_to_move = index < layout.positions;
+    uint64_t n = white_to_move ? index : index - layout.positions;
+
+    int squares[MAX_PIECES];
+    for (int i = layout.count - 1; i >= 2; i--) {
+        if (is_pawn(layout.pieces[i])) {
+            squares[i] = (int)(n % 48) + 8;
+            n /= 48;
+        } else {
+            squares[i] = (int)(n % 64);
+            n /= 64;
+        }
+    }
+    squares[1] = (int)(n % 64);
+    n /= 64;
+    squares[0] = layout.pawns ? (int)(n / 4) * 8 + (int)(n % 4) : triangle.square[n];
+
+    for (int i = 0; i < 64; i++) cr.squares[i] = ' ';
+    cr.squares[64] = '\0';
+    for (int i = 0; i < layout.count; i++) {
+        if (cr.squares[squares[i]] != ' ') {
+            return false;
+        }
+        cr.squares[squares[i]] = layout.pieces[i];
+    }
+
+    cr.white = white_to_move;
+    cr.wking_square = (thc::Square)squares[0];
+    cr.bking_square = (thc::Square)squares[1];
+    cr.enpassant_target = thc::SQUARE_INVALID;
+    cr.wking = cr.wqueen = cr.bking = cr.bqueen = 0;
+    cr.half_move_clock = 0;
+    cr.full_move_count = 1;
+    cr.Init();
+    return true;
+}
+
+bool load(const std::string& wdl_path) {
+    FileHeader header;
+    const uint8_t* wdl = map_file(wdl_path, WDL_MAGIC, header);
+    if (!wdl) {
+        return false;
+    }
+    if (!is_canonical(header.key) || piece_count(header.key) > MAX_PIECES
+            || layout(header.key).positions != header.positions) {
+        munmap((void*)(wdl - sizeof(FileHeader)), sizeof(FileHeader) + (2 * header.positions + 3) / 4);
+        return false;
+    }
+
+    Table table = { layout(header.key), wdl, nullptr };
+    std::string dtm_path = wdl_path.substr(0, wdl_path.size() - 4) + ".dtm";
+    FileHeader dtm_header;
+    table.dtm = map_file(dtm_path, DTM_MAGIC, dtm_header);
+    if (table.dtm && (dtm_header.key != header.key || dtm_header.positions != header.positions)) {
+        table.dtm = nullptr;
+    }
+
+    tables[header.key] = table;
+    largest = std::max(largest, table.layout.count);
+    return true;
+}
+
+int init(const std::string& directory) {
+    DIR* dir = opendir(directory.c_str());
+    if (!dir) {
+        return 0;
+    }
+    int loaded = 0;
+    while (struct dirent* entry = readdir(dir)) {
+        std::string file = entry->d_name;
+        if (file.size() > 4 && file.compare(file.size() - 4, 4, ".wdl") == 0 && load(directory + "/" + file)) {
+            loaded++;
+        }
+    }
+    closedir(dir);
+    return loaded;
+}
+
+int max_pieces() {
+    return largest;
+}
+
+bool probe(const thc::ChessRules& cr, Wdl& wdl, int& plies) {
+    if (largest == 0 || piece_count(cr.material_key) > largest) {
+        return false;
+    }
+    if (cr.groomed_enpassant_target() != thc::SQUARE_INVALID
+            || cr.wking_allowed() || cr.wqueen_allowed() || cr.bking_allowed() || cr.bqueen_allowed()) {
+        return false;
+    }
+
+    bool flip = !is_canonical(cr.material_key);
+    auto it = tables.find(flip ? swap_colours(cr.material_key) : cr.material_key);
+    if (it == tables.end()) {
+        return false;
+    }
+    const Table& table = it->second;
+
+    uint64_t e = index(table.layout, cr, flip);
+    int code = (table.wdl[e / 4] >> (e % 4 * 2)) & 3;
+    if (code == CODE_INVALID) {
+        return false;
+    }
+    wdl = code == CODE_WIN ? WIN : code == CODE_LOSS ? LOSS : DRAW;
+
+    // Distances are stored in moves: mate in n is 2n - 1 plies, mated in n is 2n
+    plies = -1;
+    if (table.dtm && wdl != DRAW) {
+        int moves = table.dtm[e];
+        plies = wdl == WIN ? 2 * moves - 1 : 2 * moves;
+    }
+    return true;
+}
+
+} // namespace tablebase
@@ -30,6 +30,7 @@
 #include <assert.h>
 #include <algorithm>
 #include "thc.h"
+#include "profile.h"
 using namespace std;
 using namespace thc;
 /****************************************************************************
@@ -2350,6 +2351,7 @@ void ChessRules::GenLegalMoveList( vector<Move>  &moves,
  ****************************************************************************/
 void ChessRules::GenLegalMoveList( MOVELIST *list )
 {
+    PROFILE_ZONE(profile::MOVE_GENERATION);
     int i, j;
     bool okay;
     MOVELIST list2;
@@ -2412,6 +2414,7 @@ void ChessRules::GenLegalMoveList( MOVELIST *list, bool check[MAXMOVES],
  ****************************************************************************/
 bool ChessRules::IsDraw( bool white_asks, DRAWTYPE &result )
 {
+    PROFILE_ZONE(profile::DRAW_DETECTION);
     bool   draw=false;
 
     // Insufficient mating material
@@ -2580,43 +2583,18 @@ int ChessRules::GetRepetitionCount()
  ****************************************************************************/
 bool ChessRules::IsInsufficientDraw( bool white_asks, DRAWTYPE &result )
 {
-    char   piece;
-    int    piece_count=0;
-    bool   bishop_or_knight=false, lone_wking=true, lone_bking=true;
     bool   draw=false;
 
-    // Loop through the board
-    for( Square square=a8; square<=h1; ++square )
-    {
-        piece = squares[square];
-        switch( piece )
-        {
-            case 'B':
-            case 'b':
-            case 'N':
-            case 'n':       bishop_or_knight=true;  // and fall through
-            case 'Q':
-            case 'q':
-            case 'R':
-            case 'r':
-            case 'P':
-            case 'p':       piece_count++;
-                            if( isupper(piece) )
-                                lone_wking = false;
-                            else
-                                lone_bking = false;
-                            break;
-        }
-        if( !lone_wking && !lone_bking )
-            break;  // quit early for performance
-    }
+    // Read straight from the material signature, no need to scan the board
+    bool lone_wking = (material_key & MATERIAL_WHITE_MASK) == 0;
+    bool lone_bking = (material_key & MATERIAL_BLACK_MASK) == 0;
+    bool lone_minor = material_key == (1ULL<<MATERIAL_WN) || material_key == (1ULL<<MATERIAL_WB) ||
+                      material_key == (1ULL<<MATERIAL_BN) || material_key == (1ULL<<MATERIAL_BB);
 
     // Automatic draw if K v K or K v K+N or K v K+B
     //  (note that K+B v K+N etc. is not auto granted due to
     //   selfmates in the corner)
-    if( piece_count==0 ||
-        (piece_count==1 && bishop_or_knight)
-      )
+    if( material_key==0 || lone_minor )
     {
         draw = true;
         result = DRAWTYPE_INSUFFICIENT_AUTO;
@@ -3137,14 +3115,70 @@ void ChessRules::BlackPawnMoves( MOVELIST *l, Square square )
     }
 }
 
+/****************************************************************************
+ * Material signature field of a piece, 0 for kings and empty squares
+ ****************************************************************************/
+static inline uint64_t MaterialUnit( char piece )
+{
+    switch( piece )
+    {
+        case 'P':   return 1ULL << MATERIAL_WP;
+        case 'N':   return 1ULL << MATERIAL_WN;
+        case 'B':   return 1ULL << MATERIAL_WB;
+        case 'R':   return 1ULL << MATERIAL_WR;
+        case 'Q':   return 1ULL << MATERIAL_WQ;
+        case 'p':   return 1ULL << MATERIAL_BP;
+        case 'n':   return 1ULL << MATERIAL_BN;
+        case 'b':   return 1ULL << MATERIAL_BB;
+        case 'r':   return 1ULL << MATERIAL_BR;
+        case 'q':   return 1ULL << MATERIAL_BQ;
+    }
+    return 0;
+}
+
+/****************************************************************************
+ * Recalculate the material signature from the board
+ ****************************************************************************/
+void ChessRules::CalculateMaterialKey()
+{
+    material_key = 0;
+    for( Square square=a8; square<=h1; ++square )
+        material_key += MaterialUnit( squares[square] );
+}
+
+/****************************************************************************
+ * Material signature change of a move: captured piece leaves, promoted
+ *  pawn becomes a piece
+ ****************************************************************************/
+static inline uint64_t MaterialChange( const Move& m, bool white )
+{
+    uint64_t change = 0;
+    if( m.capture != ' ' )
+        change -= MaterialUnit( m.capture );
+    switch( m.special )
+    {
+        case SPECIAL_PROMOTION_QUEEN:   change += MaterialUnit(white?'Q':'q') - MaterialUnit(white?'P':'p');  break;
+        case SPECIAL_PROMOTION_ROOK:    change += MaterialUnit(white?'R':'r') - MaterialUnit(white?'P':'p');  break;
+        case SPECIAL_PROMOTION_BISHOP:  change += MaterialUnit(white?'B':'b') - MaterialUnit(white?'P':'p');  break;
+        case SPECIAL_PROMOTION_KNIGHT:  change += MaterialUnit(white?'N':'n') - MaterialUnit(white?'P':'p');  break;
+        default:                        break;
+    }
+    return change;  // unsigned wraparound makes the subtractions work out
+}
+
 /****************************************************************************
  * Make a move (with the potential to undo)
  ****************************************************************************/
 void ChessRules::PushMove( Move& m )
 {
+    PROFILE_ZONE(profile::MAKE_MOVE);
+
     // Push old details onto stack
     DETAIL_PUSH;
 
+    // Update material signature (white is still the side making the move)
+    material_key += MaterialChange( m, white );
+
     // Update castling prohibited flags for destination square, eg h8 -> bking
     DETAIL_CASTLING(m.dst);
                     // IMPORTANT - only dst is required since we also qualify
@@ -3268,12 +3302,17 @@ void ChessRules::PushMove( Move& m )
  ****************************************************************************/
 void ChessRules::PopMove( Move& m )
 {
+    PROFILE_ZONE(profile::MAKE_MOVE);
+
     // Previous detail field
     DETAIL_POP;
 
     // Toggle who-to-move
     Toggle();
 
+    // Restore material signature
+    material_key -= MaterialChange( m, white );
+
     // Special handling might be required
     switch( m.special )
     {
@@ -3337,6 +3376,32 @@ void ChessRules::PopMove( Move& m )
 }
 
 
+/****************************************************************************
+ * Make a null move (with the potential to undo)
+ ****************************************************************************/
+void ChessRules::PushNullMove()
+{
+    // Push old details onto stack, PopNullMove() restores the en passant
+    //  target from there
+    DETAIL_PUSH;
+    enpassant_target = SQUARE_INVALID;
+
+    // Toggle who-to-move
+    Toggle();
+}
+
+/****************************************************************************
+ * Undo a null move
+ ****************************************************************************/
+void ChessRules::PopNullMove()
+{
+    // Previous detail field
+    DETAIL_POP;
+
+    // Toggle who-to-move
+    Toggle();
+}
+
 /****************************************************************************
  * Determine if an occupied square is attacked
  ****************************************************************************/
@@ -3423,6 +3488,7 @@ bool ChessRules::Evaluate( TERMINAL &score_terminal )
 
 bool ChessRules::Evaluate( MOVELIST *p, TERMINAL &score_terminal )
 {
+    PROFILE_ZONE(profile::TERMINAL_CHECK);
     /* static ;remove for thread safety */ MOVELIST local_list;
     MOVELIST &list = p?*p:local_list;
     int i, any;
@@ -3539,6 +3605,9 @@ void ChessRules::Transform()
             }
         }
     }
+
+    // Colours have swapped
+    CalculateMaterialKey();
 }
 
 
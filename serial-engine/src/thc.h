@@ -129,6 +129,24 @@ enum TERMINAL
     TERMINAL_BSTALEMATE = 2     // Black is stalemated
 };
 
+// Material signature - the number of pawns, knights, bishops, rooks and
+//  queens of each colour (kings are not counted) packed into 4 bit fields.
+//  ChessRules keeps one up to date in material_key, the values below are
+//  the bit offsets of the fields
+enum MATERIAL_FIELD
+{
+    MATERIAL_WP=0,  MATERIAL_WN=4,  MATERIAL_WB=8,  MATERIAL_WR=12, MATERIAL_WQ=16,
+    MATERIAL_BP=20, MATERIAL_BN=24, MATERIAL_BB=28, MATERIAL_BR=32, MATERIAL_BQ=36
+};
+#define MATERIAL_WHITE_MASK 0x00000fffffULL
+#define MATERIAL_BLACK_MASK 0xfffff00000ULL
+
+// Number of pieces counted in one field of a material signature
+inline int material_count( uint64_t key, MATERIAL_FIELD field )
+{
+    return (int)((key>>field) & 0x0f);
+}
+
 // Calculate an upper limit to the length of a list of moves
 #define MAXMOVES (27 + 2*13 + 2*14 + 2*8 + 8 + 8*4  +  3*27)
                 //[Q   2*B    2*R    2*N   K   8*P] +  [3*Q]
@@ -528,6 +546,7 @@ public:
         history[0].src = a8;   // (look backwards through history stops when src==dst)
         history[0].dst = a8;
         detail_idx =0;
+        CalculateMaterialKey();
     }
 
     // Copy constructor
@@ -612,6 +631,22 @@ public:
     // Undo a move
     void PopMove( Move& m );
 
+    // Pass the move to the other side without moving (a null move, as used
+    //  by null move pruning), with the potential to undo. The en passant
+    //  target is cleared; nothing is added to the move history
+    void PushNullMove();
+
+    // Undo a null move
+    void PopNullMove();
+
+    // Recalculate material_key from scratch, needed only if squares[] is
+    //  changed other than by PushMove()/PopMove() or Init()
+    void CalculateMaterialKey();
+
+    // Material signature of the position, see MATERIAL_FIELD. Maintained
+    //  incrementally by PushMove() and PopMove()
+    uint64_t material_key;
+
     // Test fundamental internal assumptions and operations
     void TestInternals();
 
@@ -0,0 +1,115 @@
+#ifndef TIME_MANAGER_H
+#define TIME_MANAGER_H
+
+/*
+ *  time-manager
+ *
+ *  How long one call to solve() may think, and the clock checks that keep it to that. There are two limits:
+ *
+ *      soft    checked between iterations of iterative deepening: no new iteration starts once it is passed
+ *      hard    checked inside the search: the iteration under way is abandoned once it is passed
+ *
+ *  On a game clock the move gets its share of the time left plus most of the increment (the soft limit), and
+ *  may run to a few times that (the hard limit) rather than throw away an iteration that is nearly done. The
+ *  soft limit then follows the best move: every change of mind in the last iterations stretches it, and a best
+ *  move that has not changed for several iterations shrinks it, so settled positions bank time for unclear
+ *  ones. A fixed move time, and the engine's default limit, are one limit used as both.
+ *
+ *  Each iteration also has to look as if it can finish before the hard limit. The time of the iterations so far
+ *  gives the effective branching factor (how many times longer each iteration takes than the one before), and an
+ *  iteration projected to run past the hard limit is not started: it would only be thrown away. On a game clock
+ *  the time saved stays on the clock for later moves.
+ *
+ *  The search calls poll() at every node, but a thread reads the clock only once every POLL_INTERVAL calls,
+ *  so the check stays cheap at any depth and the limit is overrun by at most a few thousand nodes.
+ *
+ *  When the search runs on a thread of its own (search-thread.h), another thread can stop it, or turn a search
+ *  started without a time limit (pondering) into one with a limit from that moment on. The limits and the start
+ *  time are atomics for that reason; everything else belongs to the search.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include "search-limits.h"
+#include "thc.h"
+
+namespace time_manager {
+
+constexpr uint32_t POLL_INTERVAL = 1024;    // calls of poll() between two reads of the clock, per thread
+
+constexpr int MOVES_TO_GO = 30;             // moves the time left on the clock is shared over
+constexpr double INCREMENT_SHARE = 0.75;    // of the increment, spent on the move it comes with
+constexpr double MAX_STRETCH = 4.0;         // hard limit as a multiple of the share of the clock
+constexpr int MAX_SHARE_DIVISOR = 5;        // and never more than this fraction of the time left, plus the increment
+constexpr int64_t CLOCK_MARGIN_MS = 50;     // kept back for the time it takes to play the move
+
+constexpr double CHANGE_WEIGHT = 0.5;       // soft limit stretch per recent change of best move
+constexpr int STABLE_ITERATIONS = 3;        // iterations with the same best move for it to count as settled
+constexpr double STABLE_SCALE = 0.6;        // soft limit of a settled search
+
+constexpr double MIN_MEASURED_SECONDS = 0.001;  // iterations shorter than this are too noisy to time
+constexpr double MAX_BRANCHING_FACTOR = 32.0;
+
+class TimeManager {
+public:
+    // Start timing a search for the side to move. default_seconds is the engine's limit when the limits set
+    // neither a time nor anything else to stop at.
+    void start(const search_limits::SearchLimits& limits, bool white, double default_seconds);
+
+    // Seconds since start()
+    double elapsed() const;
+
+    // Called at every node; true once the hard limit has passed or stop() was called. The clock is read every
+    // interval calls.
+    bool poll(uint32_t interval = POLL_INTERVAL);
+
+    // An iteration completed with this best move: move the soft limit with the stability of the search
+    void iteration_complete(const thc::Move& best_move);
+
+    // Whether a new iteration may start, and is projected to finish before the hard limit
+    bool time_for_iteration() const;
+
+    // Effective branching factor of the last iterations, 0 until two of them have been timed
+    double branching_factor() const { return ebf; }
+
+    // Current limits in seconds, 0 for none
+    double soft_limit() const { return soft_seconds; }
+    double hard_limit() const { return hard_seconds; }
+
+    // From another thread: stop the search under way, or the next one if none is. Holds until clear_stop().
+    void stop() { stopped.store(true, std::memory_order_relaxed); }
+    void clear_stop() { stopped.store(false, std::memory_order_relaxed); }
+
+    // From another thread: the search under way has been pondering without a time limit, and gets these limits
+    // now, counted from this moment
+    void ponder_hit(const search_limits::SearchLimits& limits, bool white, double default_seconds);
+
+private:
+    // Set the limits for a search on these limits
+    void allocate(const search_limits::SearchLimits& limits, bool white, double default_seconds);
+
+    std::atomic<std::chrono::steady_clock::time_point> start_time;
+
+    std::atomic<double> optimum_seconds{0.0};  // soft limit of a search whose best move neither changes nor settles
+    std::atomic<double> soft_seconds{0.0};
+    std::atomic<double> hard_seconds{0.0};
+    std::atomic<bool> adaptive{false};         // whether the soft limit follows the best move (on a game clock only)
+
+    thc::Move last_best_move;
+    bool have_best_move = false;
+    int stable_iterations = 0;      // completed iterations since the best move last changed
+    double changes = 0.0;           // recent changes of best move, halved every iteration
+
+    std::chrono::steady_clock::time_point last_iteration_end;
+    double last_iteration_seconds = 0.0;
+    double last_ratio = 0.0;            // of the last iteration's time to the one before, 0 if not measured
+    double ebf = 0.0;
+
+    std::atomic<bool> expired{false};
+    std::atomic<bool> stopped{false};
+};
+
+} // namespace time_manager
+
+#endif // TIME_MANAGER_H
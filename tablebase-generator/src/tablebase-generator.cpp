@@ -0,0 +1,657 @@
+/* tablebase-generator.cpp
+ *
+ *  Generates the endgame tablebases the engines probe (see tablebase.h for the index and file format).
+ *
+ *      ./tablebase-generator [-o directory] [-n pieces] [table ...]
+ *
+ *  With no tables named, every material combination of up to -n pieces (default 5, kings included) is generated;
+ *  otherwise the named ones (e.g. KQvKR) and whatever they can turn into by captures and promotions. Tables already
+ *  in the output directory (default "tablebases") are kept, so an interrupted run can be resumed.
+ *
+ *  Each table is solved by retrograde analysis. One pass over all its positions marks the impossible ones, loses
+ *  checkmates in 0 plies, draws stalemates, looks up the moves out of the table (captures and promotions, in the
+ *  smaller tables generated before) and counts the positions within the table each one's moves reach. Then, for
+ *  p = 0, 1, 2, ..., moves are un-made from every position decided in p plies, and only the positions found that
+ *  way are updated:
+ *
+ *      lost in p   the position before is won in p + 1 (unless it wins sooner)
+ *      won in p    the position before has one more move known to lose; when that was its last one and no move
+ *                  out of the table saves it, it is lost in p + 1, or later if a move out of the table loses slower
+ *
+ *  until no position is waiting for a later p. What is left is drawn. Each p is one OpenMP loop over the table,
+ *  with the updates made atomically; a position decided during it is always decided in more than p plies.
+ *
+ *  The tables have no numbers for positions where a pawn that has just moved two squares can be taken en passant,
+ *  but the positions before such a move need their values. So they are solved along with the table, numbered
+ *  after its positions: one is reached by the double push, has the moves of the same position without en passant
+ *  rights plus the captures, and leads back to the position before the push only.
+ *
+ *  A 5-piece table with a pawn has up to 800M positions and needs 3 bytes of working memory for each.
+ *
+ *      ./tablebase-generator -c [-o directory] [-n pieces] [table ...]
+ *
+ *  checks the tables instead: every position must have the value its best move leads to, looked up in the tables
+ *  (or, for a position with en passant rights, found from its own moves the same way).
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+#include <omp.h>
+#include <sys/stat.h>
+#include "thc.h"
+#include "tablebase.h"
+
+namespace {
+
+// Working values: plies to mate + 1 (odd plies are wins for the side to move, even plies losses)
+constexpr uint16_t UNKNOWN = 0;
+constexpr uint16_t DRAWN   = 0xfffe;    // stalemate
+constexpr uint16_t COPY    = 0xfffd;    // another number of a position (see tablebase.h), valued last
+constexpr uint16_t INVALID = 0xffff;    // two pieces on a square, or the side not to move in check
+
+// Moves within the table that are not yet known to lose, counted once per position they reach; SAVED when a move
+// out of the table draws or wins, so the position can never be lost
+constexpr uint8_t SAVED = 0xff;
+
+const thc::MATERIAL_FIELD FIELDS[2][5] = {
+    { thc::MATERIAL_WQ, thc::MATERIAL_WR, thc::MATERIAL_WB, thc::MATERIAL_WN, thc::MATERIAL_WP },
+    { thc::MATERIAL_BQ, thc::MATERIAL_BR, thc::MATERIAL_BB, thc::MATERIAL_BN, thc::MATERIAL_BP },
+};
+const char LETTERS[] = "QRBNP";
+
+uint64_t canonical(uint64_t key) {
+    return tablebase::is_canonical(key) ? key : tablebase::swap_colours(key);
+}
+
+int pawns(uint64_t key) {
+    return thc::material_count(key, thc::MATERIAL_WP) + thc::material_count(key, thc::MATERIAL_BP);
+}
+
+// "KQvKR" to a material signature, false if it is not a table name
+bool parse_name(const std::string& name, uint64_t& key) {
+    size_t v = name.find('v');
+    if (name.size() < 3 || name[0] != 'K' || v == std::string::npos || v + 1 >= name.size() || name[v + 1] != 'K') {
+        return false;
+    }
+    key = 0;
+    for (size_t i = 1; i < name.size(); i++) {
+        if (i == v || i == v + 1) continue;
+        size_t letter = std::string(LETTERS).find(name[i]);
+        if (letter == std::string::npos) {
+            return false;
+        }
+        key += 1ULL << FIELDS[i < v ? 0 : 1][letter];
+    }
+    return true;
+}
+
+// A table and every table a position in it can reach, canonical
+void add_with_successors(uint64_t key, std::set<uint64_t>& keys) {
+    key = canonical(key);
+    if (!keys.insert(key).second) {
+        return;
+    }
+    for (int side = 0; side < 2; side++) {
+        for (int i = 0; i < 5; i++) {
+            uint64_t piece = 1ULL << FIELDS[side][i];
+            if (thc::material_count(key, FIELDS[side][i]) == 0) continue;
+            add_with_successors(key - piece, keys);                                     // captured
+            if (i == 4) {
+                for (int j = 0; j < 4; j++) {
+                    add_with_successors(key - piece + (1ULL << FIELDS[side][j]), keys);  // promoted
+                }
+            }
+        }
+    }
+}
+
+// Every material combination with up to max_pieces pieces
+void add_all(int max_pieces, std::set<uint64_t>& keys) {
+    std::vector<uint64_t> sides = { 0 };
+    for (int n = 0; n < max_pieces - 2; n++) {
+        std::vector<uint64_t> longer;
+        for (uint64_t side : sides) {
+            for (int i = 0; i < 5; i++) longer.push_back(side + (1ULL << FIELDS[0][i]));
+        }
+        sides.insert(sides.end(), longer.begin(), longer.end());
+    }
+    for (uint64_t white : sides) {
+        for (uint64_t black : sides) {
+            uint64_t key = white | tablebase::swap_colours(black);
+            if (tablebase::piece_count(key) <= max_pieces) keys.insert(canonical(key));
+        }
+    }
+}
+
+// Value of the position after a move out of the table (a capture or a promotion), from the point of view of the
+// side now to move
+uint16_t exit_value(thc::ChessRules& cr) {
+    tablebase::Wdl wdl;
+    int plies;
+    if (!tablebase::probe(cr, wdl, plies) || (wdl != tablebase::DRAW && plies < 0)) {
+        std::fprintf(stderr, "missing table %s\n", tablebase::name(canonical(cr.material_key)).c_str());
+        std::exit(1);
+    }
+    return wdl == tablebase::DRAW ? DRAWN : (uint16_t)(plies + 1);
+}
+
+// Value of a position lost through every move out of the table: the slowest of those losses
+uint16_t slowest_exit(const tablebase::Layout& layout, thc::ChessRules& cr) {
+    thc::MOVELIST list;
+    cr.GenLegalMoveList(&list);
+    uint16_t slowest = 0;
+    for (int i = 0; i < list.count; i++) {
+        cr.PushMove(list.moves[i]);
+        if (cr.material_key != layout.key) {
+            slowest = std::max(slowest, (uint16_t)(exit_value(cr) + 1));
+        }
+        cr.PopMove(list.moves[i]);
+    }
+    return slowest;
+}
+
+const int KING_STEPS[8][2]   = { {1, 0}, {1, 1}, {0, 1}, {-1, 1}, {-1, 0}, {-1, -1}, {0, -1}, {1, -1} };
+const int KNIGHT_STEPS[8][2] = { {1, 2}, {2, 1}, {2, -1}, {1, -2}, {-1, -2}, {-2, -1}, {-2, 1}, {-1, 2} };
+
+// Squares as in thc: a8 = 0, h1 = 63
+int file_of(int sq) { return sq & 7; }
+int rank_of(int sq) { return 7 - (sq >> 3); }    // 0 for the first rank
+
+// Whether the side to move in cr can take en passant on target, were a pawn to have just passed it
+bool en_passant_legal(thc::ChessRules& cr, int target) {
+    thc::Square saved = cr.enpassant_target;
+    cr.enpassant_target = (thc::Square)target;
+    bool legal = false;
+    if (cr.groomed_enpassant_target() != thc::SQUARE_INVALID) {
+        thc::MOVELIST list;
+        cr.GenLegalMoveList(&list);
+        for (int i = 0; i < list.count && !legal; i++) {
+            thc::SPECIAL special = list.moves[i].special;
+            legal = special == thc::SPECIAL_WEN_PASSANT || special == thc::SPECIAL_BEN_PASSANT;
+        }
+    }
+    cr.enpassant_target = saved;
+    return legal;
+}
+
+// Call found with each square a pawn of the side not to move in cr can just have passed by moving two squares,
+// with en passant on it legal for the side to move
+template <class Found>
+void en_passant_targets(thc::ChessRules& cr, Found found) {
+    bool mover_white = !cr.white;
+    thc::Square king = cr.white ? cr.wking_square : cr.bking_square;
+    char pawn = mover_white ? 'P' : 'p';
+    int back = mover_white ? 8 : -8;
+    for (int to = 0; to < 64; to++) {
+        if (cr.squares[to] != pawn || (mover_white ? rank_of(to) : 7 - rank_of(to)) != 3
+                || cr.squares[to + back] != ' ' || cr.squares[to + 2 * back] != ' ') {
+            continue;
+        }
+        // The position before the push is only possible if the mover was not giving check in it
+        cr.squares[to + 2 * back] = pawn;
+        cr.squares[to] = ' ';
+        bool possible = !cr.AttackedSquare(king, mover_white);
+        cr.squares[to] = pawn;
+        cr.squares[to + 2 * back] = ' ';
+        if (possible && en_passant_legal(cr, to + back)) {
+            found(to + back);
+        }
+    }
+}
+
+// Call found with cr set up as each position the side not to move could have come from by a move that is not a
+// capture or a promotion (those come from other tables), with cr's pieces put back after each. A double push
+// that can be taken en passant is left out: it leads to the position with en passant rights instead.
+template <class Found>
+void unmoves(thc::ChessRules& cr, Found found) {
+    bool mover_white = !cr.white;
+    thc::Square king = cr.white ? cr.wking_square : cr.bking_square;    // of the side to move in cr
+
+    auto from = [&](int to, int sq) {
+        char piece = cr.squares[to];
+        cr.squares[sq] = piece;
+        cr.squares[to] = ' ';
+        if (piece == 'K') cr.wking_square = (thc::Square)sq;
+        if (piece == 'k') cr.bking_square = (thc::Square)sq;
+        cr.white = mover_white;
+        // The position before the move is only possible if the mover was not giving check in it
+        if (!cr.AttackedSquare(king, mover_white)) {
+            found(cr);
+        }
+        cr.white = !mover_white;
+        if (piece == 'K') cr.wking_square = (thc::Square)to;
+        if (piece == 'k') cr.bking_square = (thc::Square)to;
+        cr.squares[to] = piece;
+        cr.squares[sq] = ' ';
+    };
+
+    for (int to = 0; to < 64; to++) {
+        char piece = cr.squares[to];
+        if (piece == ' ' || (piece < 'a') != mover_white) continue;
+
+        char kind = piece < 'a' ? piece : (char)(piece - 'a' + 'A');
+        if (kind == 'P') {
+            // One square back, or two from the fourth rank (the fifth for black) to the starting one
+            int back = mover_white ? 8 : -8;
+            int rank = mover_white ? rank_of(to) : 7 - rank_of(to);
+            if (rank >= 2 && cr.squares[to + back] == ' ') {
+                from(to, to + back);
+                if (rank == 3 && cr.squares[to + 2 * back] == ' ' && !en_passant_legal(cr, to + back)) {
+                    from(to, to + 2 * back);
+                }
+            }
+            continue;
+        }
+
+        bool slides = kind != 'K' && kind != 'N';
+        const int (*steps)[2] = kind == 'N' ? KNIGHT_STEPS : KING_STEPS;
+        for (int d = 0; d < 8; d++) {
+            bool diagonal = steps[d][0] != 0 && steps[d][1] != 0;
+            if ((kind == 'R' && diagonal) || (kind == 'B' && !diagonal)) continue;
+            int file = file_of(to), rank = rank_of(to);
+            for (;;) {
+                file += steps[d][0];
+                rank += steps[d][1];
+                int sq = (7 - rank) * 8 + file;
+                if (file < 0 || file > 7 || rank < 0 || rank > 7 || cr.squares[sq] != ' ') break;
+                from(to, sq);
+                if (!slides) break;
+            }
+        }
+    }
+}
+
+struct Totals {
+    uint64_t wins = 0, draws = 0, losses = 0;
+    int longest = 0;
+};
+
+bool generate(uint64_t key, const std::string& directory, Totals& totals) {
+    tablebase::Layout layout = tablebase::layout(key);
+    int64_t entries = 2 * layout.positions;
+    std::vector<uint16_t> values(entries, UNKNOWN);
+
+    // Impossible positions and other numbers of a position set aside, and the positions with en passant rights
+    // found, as number * 64 + the square the pawn passed
+    std::vector<uint64_t> passants;
+    #pragma omp parallel
+    {
+        std::vector<uint64_t> found;
+
+        #pragma omp for schedule(dynamic, 4096)
+        for (int64_t e = 0; e < entries; e++) {
+            thc::ChessRules cr;
+            if (!tablebase::decode(layout, e, cr) || !cr.Evaluate()) {
+                values[e] = INVALID;
+                continue;
+            }
+            if (tablebase::index(layout, cr, false) != (uint64_t)e) {
+                values[e] = COPY;
+                continue;
+            }
+            if (layout.pawns) {
+                en_passant_targets(cr, [&](int target) { found.push_back(e * 64 + target); });
+            }
+        }
+
+        #pragma omp critical
+        passants.insert(passants.end(), found.begin(), found.end());
+    }
+    std::sort(passants.begin(), passants.end());
+
+    // Those come after the table's numbers
+    int64_t ids = entries + (int64_t)passants.size();
+    values.resize(ids, UNKNOWN);
+    std::vector<uint8_t> unresolved(ids, SAVED);
+    int last = 0;   // highest value given so far
+
+    auto position = [&](int64_t id, thc::ChessRules& cr) {
+        if (id < entries) {
+            tablebase::decode(layout, id, cr);
+            return;
+        }
+        tablebase::decode(layout, passants[id - entries] / 64, cr);
+        cr.enpassant_target = (thc::Square)(passants[id - entries] % 64);
+    };
+
+    // Number of the position after a move within the table
+    auto reached_id = [&](thc::ChessRules& cr) {
+        uint64_t e = tablebase::index(layout, cr, false);
+        if (cr.enpassant_target == thc::SQUARE_INVALID || !en_passant_legal(cr, cr.enpassant_target)) {
+            return (int64_t)e;
+        }
+        // The target square as on the board the number decodes to, which is this one or its mirror image
+        thc::ChessRules numbered;
+        tablebase::decode(layout, e, numbered);
+        int target = std::memcmp(numbered.squares, cr.squares, 64) == 0 ? cr.enpassant_target : cr.enpassant_target ^ 7;
+        auto it = std::lower_bound(passants.begin(), passants.end(), e * 64 + target);
+        if (it == passants.end() || *it != e * 64 + target) {
+            std::fprintf(stderr, "%s: en passant position not found\n", tablebase::name(key).c_str());
+            std::exit(1);
+        }
+        return entries + (int64_t)(it - passants.begin());
+    };
+
+    // Every position once: checkmates lost in 0, stalemates drawn, moves out of the table looked up, and the
+    // positions in the table a move reaches counted
+    #pragma omp parallel for schedule(dynamic, 4096) reduction(max:last)
+    for (int64_t id = 0; id < ids; id++) {
+        if (values[id] == INVALID || values[id] == COPY) continue;
+        thc::ChessRules cr;
+        position(id, cr);
+        thc::MOVELIST list;
+        cr.GenLegalMoveList(&list);
+        if (list.count == 0) {
+            bool in_check = cr.AttackedPiece((thc::Square)(cr.white ? cr.wking_square : cr.bking_square));
+            values[id] = in_check ? 1 : DRAWN;
+            if (in_check) last = std::max(last, 1);
+            continue;
+        }
+
+        int64_t reached[MAXMOVES];
+        int count = 0;
+        int quickest_win = INT_MAX, slowest_loss = 0;
+        bool saved = false;         // a move out of the table does not lose
+        for (int i = 0; i < list.count; i++) {
+            cr.PushMove(list.moves[i]);
+            if (cr.material_key == layout.key) {
+                reached[count++] = reached_id(cr);
+            } else {
+                uint16_t v = exit_value(cr);
+                if (v == DRAWN) {
+                    saved = true;
+                } else if ((v - 1) % 2 == 0) {
+                    quickest_win = std::min(quickest_win, v + 1);
+                    saved = true;
+                } else {
+                    slowest_loss = std::max(slowest_loss, v + 1);
+                }
+            }
+            cr.PopMove(list.moves[i]);
+        }
+        std::sort(reached, reached + count);
+        count = (int)(std::unique(reached, reached + count) - reached);
+
+        if (quickest_win != INT_MAX) {
+            values[id] = (uint16_t)quickest_win;    // unless a move within the table wins sooner
+        } else if (!saved && count == 0) {
+            values[id] = (uint16_t)slowest_loss;
+        }
+        if (!saved) {
+            unresolved[id] = (uint8_t)count;
+        }
+        if (values[id] != UNKNOWN) {
+            last = std::max(last, (int)values[id]);
+        }
+    }
+
+    // Then ply by ply from the mates, un-making moves from the positions decided at each: a position one move
+    // before a loss is won, and one before a win is lost once that was its last move within the table not known
+    // to lose
+    for (int plies = 0; plies < last; plies++) {
+        uint16_t v = (uint16_t)(plies + 1);
+        bool lost = plies % 2 == 0;
+
+        #pragma omp parallel reduction(max:last)
+        {
+            std::vector<int64_t> before;
+
+            #pragma omp for schedule(dynamic, 4096)
+            for (int64_t id = 0; id < ids; id++) {
+                if (values[id] != v) continue;
+
+                thc::ChessRules cr;
+                position(id, cr);
+                before.clear();
+                if (id < entries) {
+                    unmoves(cr, [&](thc::ChessRules& previous) {
+                        before.push_back(tablebase::index(layout, previous, false));
+                    });
+                } else {
+                    // Only the double push leads here: put the pawn back where it started
+                    int target = cr.enpassant_target;
+                    int to = cr.white ? target + 8 : target - 8;
+                    cr.squares[2 * target - to] = cr.squares[to];
+                    cr.squares[to] = ' ';
+                    cr.white = !cr.white;
+                    cr.enpassant_target = thc::SQUARE_INVALID;
+                    before.push_back(tablebase::index(layout, cr, false));
+                }
+                // The same positions with en passant rights have the same moves, and more
+                for (size_t k = 0, n = before.size(); k < n; k++) {
+                    uint64_t b = before[k];
+                    auto it = std::lower_bound(passants.begin(), passants.end(), b * 64);
+                    for (; it != passants.end() && *it / 64 == b; ++it) {
+                        before.push_back(entries + (it - passants.begin()));
+                    }
+                }
+                std::sort(before.begin(), before.end());
+                before.erase(std::unique(before.begin(), before.end()), before.end());
+
+                for (int64_t b : before) {
+                    if (lost) {
+                        // Won in plies + 1, unless already won sooner
+                        uint16_t won = v + 1;
+                        uint16_t current = __atomic_load_n(&values[b], __ATOMIC_RELAXED);
+                        while ((current == UNKNOWN || current > won)
+                               && !__atomic_compare_exchange_n(&values[b], &current, won, false,
+                                                               __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                        }
+                        last = std::max(last, (int)won);
+                        continue;
+                    }
+                    if (values[b] != UNKNOWN || unresolved[b] == SAVED) continue;
+                    uint8_t left;
+                    #pragma omp atomic capture
+                    left = --unresolved[b];
+                    if (left == 0) {
+                        // Every move loses: this one, the slowest within the table, or one out of it
+                        thc::ChessRules previous;
+                        position(b, previous);
+                        values[b] = std::max((uint16_t)(v + 1), slowest_exit(layout, previous));
+                        last = std::max(last, (int)values[b]);
+                    }
+                }
+            }
+        }
+    }
+
+    // The other numbers of a position take its value
+    #pragma omp parallel for schedule(dynamic, 4096)
+    for (int64_t e = 0; e < entries; e++) {
+        if (values[e] != COPY) continue;
+        thc::ChessRules cr;
+        tablebase::decode(layout, e, cr);
+        values[e] = values[tablebase::index(layout, cr, false)];
+    }
+
+    // Write both files
+    std::vector<uint8_t> wdl((entries + 3) / 4, 0);
+    std::vector<uint8_t> dtm(entries, 0);
+    for (int64_t e = 0; e < entries; e++) {
+        int code = tablebase::CODE_DRAW;
+        uint16_t v = values[e];
+        if (v == INVALID) {
+            code = tablebase::CODE_INVALID;
+        } else if (v != UNKNOWN && v != DRAWN) {
+            int plies = v - 1;
+            bool win = plies % 2 == 1;
+            int moves = win ? (plies + 1) / 2 : plies / 2;
+            if (moves > 255) {
+                std::fprintf(stderr, "%s: mate in %d does not fit\n", tablebase::name(key).c_str(), moves);
+                return false;
+            }
+            code = win ? tablebase::CODE_WIN : tablebase::CODE_LOSS;
+            dtm[e] = (uint8_t)moves;
+            (win ? totals.wins : totals.losses)++;
+            totals.longest = std::max(totals.longest, moves);
+        }
+        if (code == tablebase::CODE_DRAW) totals.draws++;
+        wdl[e / 4] |= code << (e % 4 * 2);
+    }
+
+    std::string path = directory + "/" + tablebase::name(key);
+    tablebase::FileHeader header = {};
+    header.key = key;
+    header.positions = layout.positions;
+    header.pieces = layout.count;
+
+    const std::pair<const char*, const std::vector<uint8_t>*> files[] = {
+        { tablebase::WDL_MAGIC, &wdl }, { tablebase::DTM_MAGIC, &dtm }
+    };
+    for (auto& file : files) {
+        std::memcpy(header.magic, file.first, sizeof(header.magic));
+        std::string name = path + (file.second == &wdl ? ".wdl" : ".dtm");
+        FILE* f = std::fopen(name.c_str(), "wb");
+        bool ok = f && std::fwrite(&header, sizeof(header), 1, f) == 1
+                    && std::fwrite(file.second->data(), 1, file.second->size(), f) == file.second->size();
+        if (f) ok = std::fclose(f) == 0 && ok;
+        if (!ok) {
+            std::fprintf(stderr, "cannot write %s\n", name.c_str());
+            return false;
+        }
+    }
+    return tablebase::load(path + ".wdl");
+}
+
+// Value of cr from its moves, each looked up in the tables, or found the same way when it has en passant rights
+// (the tables leave those out). Plies to mate + 1 as in generate, DRAWN for a draw.
+uint16_t value_by_moves(thc::ChessRules& cr) {
+    thc::MOVELIST list;
+    cr.GenLegalMoveList(&list);
+    if (list.count == 0) {
+        return cr.AttackedPiece((thc::Square)(cr.white ? cr.wking_square : cr.bking_square)) ? 1 : DRAWN;
+    }
+    int quickest_win = INT_MAX, slowest_loss = 0;
+    bool all_lose = true;
+    for (int i = 0; i < list.count; i++) {
+        cr.PushMove(list.moves[i]);
+        uint16_t v = cr.groomed_enpassant_target() != thc::SQUARE_INVALID ? value_by_moves(cr) : exit_value(cr);
+        cr.PopMove(list.moves[i]);
+        if (v == DRAWN) {
+            all_lose = false;
+        } else if ((v - 1) % 2 == 0) {
+            quickest_win = std::min(quickest_win, v + 1);
+            all_lose = false;
+        } else {
+            slowest_loss = std::max(slowest_loss, v + 1);
+        }
+    }
+    return quickest_win != INT_MAX ? (uint16_t)quickest_win : all_lose ? (uint16_t)slowest_loss : DRAWN;
+}
+
+// Check every position of a generated table against its moves, returns how many are wrong
+uint64_t check(uint64_t key) {
+    tablebase::Layout layout = tablebase::layout(key);
+    int64_t entries = 2 * layout.positions;
+    uint64_t wrong = 0;
+
+    #pragma omp parallel for schedule(dynamic, 4096) reduction(+:wrong)
+    for (int64_t e = 0; e < entries; e++) {
+        thc::ChessRules cr;
+        if (!tablebase::decode(layout, e, cr) || !cr.Evaluate()) continue;
+        uint16_t stored = exit_value(cr);
+        uint16_t expected = value_by_moves(cr);
+        if (stored != expected) {
+            #pragma omp critical
+            if (wrong < 10) {
+                std::printf("%s: %s is %d, its moves give %d (plies to mate + 1, %d a draw)\n",
+                            tablebase::name(key).c_str(), cr.ForsythPublish().c_str(), stored, expected, DRAWN);
+            }
+            wrong++;
+        }
+    }
+    return wrong;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::string directory = "tablebases";
+    int max_pieces = tablebase::MAX_PIECES;
+    bool checking = false;
+    std::set<uint64_t> keys;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "-c") {
+            checking = true;
+        } else if (arg == "-o" && i + 1 < argc) {
+            directory = argv[++i];
+        } else if (arg == "-n" && i + 1 < argc) {
+            max_pieces = std::atoi(argv[++i]);
+        } else if (uint64_t key; parse_name(arg, key)) {
+            add_with_successors(key, keys);
+        } else {
+            std::fprintf(stderr, "usage: %s [-c] [-o directory] [-n pieces] [table ...]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (max_pieces < 2 || max_pieces > tablebase::MAX_PIECES) {
+        std::fprintf(stderr, "tables go up to %d pieces\n", tablebase::MAX_PIECES);
+        return 1;
+    }
+    if (keys.empty()) {
+        add_all(max_pieces, keys);
+    }
+    for (uint64_t key : keys) {
+        if (tablebase::piece_count(key) > tablebase::MAX_PIECES) {
+            std::fprintf(stderr, "%s has more than %d pieces\n", tablebase::name(key).c_str(), tablebase::MAX_PIECES);
+            return 1;
+        }
+    }
+
+    // Smaller tables first: captures lower the piece count, promotions the pawn count
+    std::vector<uint64_t> order(keys.begin(), keys.end());
+    std::stable_sort(order.begin(), order.end(), [](uint64_t a, uint64_t b) {
+        return std::make_pair(tablebase::piece_count(a), pawns(a)) < std::make_pair(tablebase::piece_count(b), pawns(b));
+    });
+
+    if (checking) {
+        tablebase::init(directory);
+        uint64_t wrong = 0;
+        for (uint64_t key : order) {
+            std::string name = tablebase::name(key);
+            if (!tablebase::load(directory + "/" + name + ".wdl")) {
+                std::fprintf(stderr, "missing table %s\n", name.c_str());
+                return 1;
+            }
+            uint64_t table_wrong = check(key);
+            std::printf("%-10s %12llu wrong\n", name.c_str(), (unsigned long long)table_wrong);
+            wrong += table_wrong;
+        }
+        return wrong == 0 ? 0 : 1;
+    }
+
+    mkdir(directory.c_str(), 0755);
+    tablebase::init(directory);
+    std::printf("%zu tables, %d threads\n", order.size(), omp_get_max_threads());
+
+    for (uint64_t key : order) {
+        std::string name = tablebase::name(key);
+        if (tablebase::load(directory + "/" + name + ".wdl")) {
+            std::printf("%-10s already generated\n", name.c_str());
+            continue;
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        Totals totals;
+        if (!generate(key, directory, totals)) {
+            return 1;
+        }
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::printf("%-10s %12llu won %12llu drawn %12llu lost, longest mate %3d, %.1f s\n", name.c_str(),
+                    (unsigned long long)totals.wins, (unsigned long long)totals.draws,
+                    (unsigned long long)totals.losses, totals.longest, seconds);
+        std::fflush(stdout);
+    }
+    return 0;
+}